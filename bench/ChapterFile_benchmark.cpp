@@ -0,0 +1,47 @@
+#include "ChapterFile.hpp"
+#include <benchmark/benchmark.h>
+#include <format>
+#include <fstream>
+
+namespace {
+constexpr auto ChapterCount = 1'000'000;
+
+std::string formatTimestamp(int seconds)
+{
+    return std::format("{:02}:{:02}:{:02}.000", seconds / 3600, seconds / 60 % 60, seconds % 60);
+}
+
+std::filesystem::path writeWebVtt()
+{
+    const auto path = std::filesystem::temp_directory_path() / "seekbar_chapters_benchmark.vtt";
+    auto stream = std::ofstream{path};
+    stream << "WEBVTT\n";
+    for (auto i = 0; i < ChapterCount; ++i) {
+        stream << '\n'
+               << formatTimestamp(i) << " --> " << formatTimestamp(i + 1) << '\n'
+               << "Chapter " << i << " of the benchmark film\n";
+    }
+    return path;
+}
+} // namespace
+
+static void BM_LoadWebVtt(benchmark::State &state)
+{
+    const auto path = writeWebVtt();
+    for (auto _ : state) {
+        auto chapterFile = ChapterFile::load(path);
+        benchmark::DoNotOptimize(chapterFile);
+    }
+    state.SetItemsProcessed(state.iterations() * ChapterCount);
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(path));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_LoadWebVtt)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseTimestamp(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ChapterFile::parseTimestamp("01:23:45.678"));
+    }
+}
+BENCHMARK(BM_ParseTimestamp);
@@ -0,0 +1,173 @@
+#include "FlatTree.hpp"
+#include "Layout.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+constexpr auto Rows = 100;
+constexpr auto Columns = 99;
+constexpr auto ElementSize = 8.f;
+
+std::unique_ptr<Layout> createTree()
+{
+    auto root = std::make_unique<Layout>(Orientation::Vertical);
+    root->setSize({Columns * ElementSize, Rows * ElementSize});
+    for (auto row = 0; row < Rows; ++row) {
+        auto layout = std::make_unique<Layout>(Orientation::Horizontal);
+        layout->setFillHeight(false);
+        for (auto column = 0; column < Columns; ++column) {
+            auto element = std::make_unique<UiElement>();
+            element->setSize({ElementSize, ElementSize});
+            layout->addEntry(std::move(element));
+        }
+        root->addEntry(std::move(layout));
+    }
+    root->updateLayout();
+    return root;
+}
+
+// A single row as wide as a seek bar with one element per chapter.
+std::unique_ptr<Layout> createRow()
+{
+    constexpr auto Count = Rows * Columns;
+    auto root = std::make_unique<Layout>(Orientation::Horizontal);
+    root->setSize({Count * ElementSize, ElementSize});
+    for (auto column = 0; column < Count; ++column) {
+        auto element = std::make_unique<UiElement>();
+        element->setSize({ElementSize, ElementSize});
+        root->addEntry(std::move(element));
+    }
+    root->updateLayout();
+    return root;
+}
+
+sf::Vector2f pointAt(std::size_t i)
+{
+    return {(i * 7 % Columns + 0.5f) * ElementSize, (i * 13 % Rows + 0.5f) * ElementSize};
+}
+
+float visit(const UiElement &element, sf::Vector2f origin)
+{
+    const auto position = origin + element.getPosition();
+    auto area = element.size().x * element.size().y;
+    for (auto i = std::size_t{0}; i < element.childCount(); ++i) {
+        area += visit(*element.child(i), position);
+    }
+    return area;
+}
+
+const UiElement *hitTest(const UiElement &root, sf::Vector2f point)
+{
+    if (!root.containsMouse(sf::Vector2i{point})) {
+        return nullptr;
+    }
+    const auto *element = &root;
+    for (auto found = true; found;) {
+        found = false;
+        point -= element->getPosition();
+        for (auto i = std::size_t{0}; i < element->childCount(); ++i) {
+            if (element->child(i)->containsMouse(sf::Vector2i{point})) {
+                element = element->child(i);
+                found = true;
+                break;
+            }
+        }
+    }
+    return element;
+}
+} // namespace
+
+static void BM_PointerTreeTraversal(benchmark::State &state)
+{
+    const auto root = createTree();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(visit(*root, {}));
+    }
+}
+BENCHMARK(BM_PointerTreeTraversal);
+
+static void BM_FlatTreeTraversal(benchmark::State &state)
+{
+    const auto root = createTree();
+    auto tree = FlatTree{};
+    tree.rebuild(*root);
+    for (auto _ : state) {
+        auto area = 0.f;
+        for (auto node = std::size_t{0}; node < tree.size(); ++node) {
+            area += tree.rect(node).width * tree.rect(node).height;
+        }
+        benchmark::DoNotOptimize(area);
+    }
+}
+BENCHMARK(BM_FlatTreeTraversal);
+
+static void BM_FlatTreeSync(benchmark::State &state)
+{
+    const auto root = createTree();
+    auto tree = FlatTree{};
+    tree.rebuild(*root);
+    for (auto _ : state) {
+        tree.sync();
+    }
+}
+BENCHMARK(BM_FlatTreeSync);
+
+static void BM_FlatTreeIdleUpdateLayout(benchmark::State &state)
+{
+    const auto root = createTree();
+    auto tree = FlatTree{};
+    tree.rebuild(*root);
+    for (auto _ : state) {
+        tree.updateLayout();
+    }
+}
+BENCHMARK(BM_FlatTreeIdleUpdateLayout);
+
+static void BM_PointerTreeHitTest(benchmark::State &state)
+{
+    const auto root = createTree();
+    for (auto i = std::size_t{0}; auto _ : state) {
+        benchmark::DoNotOptimize(hitTest(*root, pointAt(i++)));
+    }
+}
+BENCHMARK(BM_PointerTreeHitTest);
+
+static void BM_FlatTreeHitTest(benchmark::State &state)
+{
+    const auto root = createTree();
+    auto tree = FlatTree{};
+    tree.rebuild(*root);
+    for (auto i = std::size_t{0}; auto _ : state) {
+        benchmark::DoNotOptimize(tree.hitTest(pointAt(i++)));
+    }
+}
+BENCHMARK(BM_FlatTreeHitTest);
+
+static void BM_PointerTreeHitTestWideRow(benchmark::State &state)
+{
+    const auto root = createRow();
+    for (auto i = std::size_t{0}; auto _ : state) {
+        benchmark::DoNotOptimize(hitTest(*root, {(i++ * 7919 % (Rows * Columns) + 0.5f) * ElementSize, 1}));
+    }
+}
+BENCHMARK(BM_PointerTreeHitTestWideRow);
+
+static void BM_FlatTreeHitTestWideRow(benchmark::State &state)
+{
+    const auto root = createRow();
+    auto tree = FlatTree{};
+    tree.rebuild(*root);
+    for (auto i = std::size_t{0}; auto _ : state) {
+        benchmark::DoNotOptimize(tree.hitTest({(i++ * 7919 % (Rows * Columns) + 0.5f) * ElementSize, 1}));
+    }
+}
+BENCHMARK(BM_FlatTreeHitTestWideRow);
+
+static void BM_FlatTreeRebuild(benchmark::State &state)
+{
+    const auto root = createTree();
+    auto tree = FlatTree{};
+    for (auto _ : state) {
+        tree.rebuild(*root);
+    }
+}
+BENCHMARK(BM_FlatTreeRebuild);
@@ -0,0 +1,57 @@
+#include "IntervalSet.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr auto Period = std::chrono::milliseconds{10'000};
+
+// Buffered every other period, the worst case a loader that keeps being seeked around leaves behind.
+IntervalSet fragmentedSet(std::int64_t count)
+{
+    auto set = IntervalSet{};
+    for (auto i = std::int64_t{0}; i < count; ++i) {
+        set.insert(2 * i * Period, (2 * i + 1) * Period);
+    }
+    return set;
+}
+
+std::vector<std::chrono::milliseconds> randomTimes(std::int64_t count)
+{
+    auto random = std::mt19937_64{42};
+    auto distribution = std::uniform_int_distribution<std::int64_t>{0, 2 * count * Period.count()};
+    auto times = std::vector<std::chrono::milliseconds>(4096);
+    for (auto &time : times) {
+        time = std::chrono::milliseconds{distribution(random)};
+    }
+    return times;
+}
+} // namespace
+
+static void BM_IntervalSetLookup(benchmark::State &state)
+{
+    const auto set = fragmentedSet(state.range(0));
+    const auto times = randomTimes(state.range(0));
+    auto i = std::size_t{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.intervalAt(times[i++ % times.size()]));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_IntervalSetLookup)->RangeMultiplier(8)->Range(1 << 6, 1 << 21)->Complexity(benchmark::oLogN);
+
+// Re-delivering an already buffered span takes the full merge path (erase plus emplace) without changing the
+// number of intervals, so every iteration sees the same fragmentation.
+static void BM_IntervalSetInsert(benchmark::State &state)
+{
+    auto set = fragmentedSet(state.range(0));
+    const auto times = randomTimes(state.range(0));
+    auto i = std::size_t{0};
+    for (auto _ : state) {
+        const auto start = times[i++ % times.size()] / (2 * Period) * (2 * Period);
+        set.insert(start, start + Period);
+    }
+    benchmark::DoNotOptimize(set.total());
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_IntervalSetInsert)->RangeMultiplier(8)->Range(1 << 6, 1 << 21)->Complexity(benchmark::oLogN);
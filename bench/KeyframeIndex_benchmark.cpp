@@ -0,0 +1,55 @@
+#include "KeyframeIndex.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+constexpr auto KeyframeInterval = std::chrono::milliseconds{2000};
+
+std::vector<std::chrono::milliseconds> queries(std::chrono::milliseconds duration)
+{
+    auto random = std::mt19937_64{42};
+    auto distribution = std::uniform_int_distribution<std::int64_t>{0, duration.count()};
+    auto times = std::vector<std::chrono::milliseconds>(4096);
+    for (auto &time : times) {
+        time = std::chrono::milliseconds{distribution(random)};
+    }
+    return times;
+}
+} // namespace
+
+static void BM_NearestKeyframe(benchmark::State &state)
+{
+    const auto duration = KeyframeInterval * state.range(0);
+    const auto index = KeyframeIndex::uniform(KeyframeInterval, duration);
+    const auto times = queries(duration);
+    auto i = std::size_t{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.nearest(times[i++ % times.size()]));
+    }
+    state.SetComplexityN(state.range(0));
+    state.counters["bytesPerKeyframe"] = double(index.memoryUsage()) / double(index.size());
+}
+BENCHMARK(BM_NearestKeyframe)->RangeMultiplier(8)->Range(1 << 10, 1 << 25)->Complexity(benchmark::oLogN);
+
+static void BM_NearestKeyframeLinearScan(benchmark::State &state)
+{
+    const auto duration = KeyframeInterval * state.range(0);
+    auto keyframes = std::vector<std::chrono::milliseconds>{};
+    for (auto time = std::chrono::milliseconds{0}; time <= duration; time += KeyframeInterval) {
+        keyframes.push_back(time);
+    }
+    const auto times = queries(duration);
+    auto i = std::size_t{0};
+    for (auto _ : state) {
+        const auto time = times[i++ % times.size()];
+        auto nearest = keyframes.front();
+        for (const auto keyframe : keyframes) {
+            if (std::chrono::abs(keyframe - time) < std::chrono::abs(nearest - time)) {
+                nearest = keyframe;
+            }
+        }
+        benchmark::DoNotOptimize(nearest);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_NearestKeyframeLinearScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 16)->Complexity(benchmark::oN);
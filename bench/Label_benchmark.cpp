@@ -0,0 +1,37 @@
+#include "Label.hpp"
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// The font and atlas half of time-to-first-frame in both font modes: loading fonts/Arial.ttf from disk, or from a
+// byte array already in memory as SEEKBAR_EMBED_FONT does, followed by the startup glyph prewarm. The window and
+// the first draw are not included; seekbar prints the full time-to-first-frame on exit.
+
+static void BM_LoadFontFromFile(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto font = sf::Font{};
+        if (!font.loadFromFile(SEEKBAR_FONT_FILE)) {
+            state.SkipWithError("cannot load " SEEKBAR_FONT_FILE);
+            return;
+        }
+        Label::prewarmGlyphs(font);
+    }
+}
+BENCHMARK(BM_LoadFontFromFile)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadEmbeddedFont(benchmark::State &state)
+{
+    auto stream = std::ifstream{SEEKBAR_FONT_FILE, std::ios::binary};
+    const auto data = std::vector<char>{std::istreambuf_iterator<char>{stream}, {}};
+    for (auto _ : state) {
+        auto font = sf::Font{};
+        if (!font.loadFromMemory(data.data(), data.size())) {
+            state.SkipWithError("cannot load " SEEKBAR_FONT_FILE);
+            return;
+        }
+        Label::prewarmGlyphs(font);
+    }
+}
+BENCHMARK(BM_LoadEmbeddedFont)->Unit(benchmark::kMillisecond);
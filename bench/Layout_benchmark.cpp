@@ -0,0 +1,112 @@
+#include "Layout.hpp"
+#include "Spacer.hpp"
+#include <benchmark/benchmark.h>
+
+// The leaves are plain UiElements, so these cases time the measure and arrange
+// passes only; no text or shape geometry is rebuilt while laying out.
+namespace {
+auto createElement(sf::Vector2f size)
+{
+    auto element = std::make_unique<UiElement>();
+    element->setSize(size);
+    return element;
+}
+
+struct Tree
+{
+    std::unique_ptr<Layout> root;
+    UiElement *leaf{};
+};
+
+Tree createDeepTree(std::int64_t depth)
+{
+    auto tree = Tree{std::make_unique<Layout>(Orientation::Vertical), nullptr};
+    tree.root->setSize({800, 600});
+    auto *layout = tree.root.get();
+    for (auto level = std::int64_t{0}; level < depth; ++level) {
+        const auto orientation = level % 2 == 0 ? Orientation::Horizontal : Orientation::Vertical;
+        auto child = std::make_unique<Layout>(orientation);
+        child->setFillWidth(true);
+        child->setFillHeight(true);
+        auto *next = child.get();
+        layout->addEntry(createElement({2, 2}));
+        layout->addEntry(std::move(child));
+        layout = next;
+    }
+    auto leaf = createElement({10, 10});
+    tree.leaf = leaf.get();
+    layout->addEntry(std::move(leaf));
+    tree.root->updateLayout();
+    return tree;
+}
+
+Tree createWideTree(std::int64_t width)
+{
+    auto tree = Tree{std::make_unique<Layout>(Orientation::Horizontal), nullptr};
+    tree.root->setSize({800, 600});
+    for (auto i = std::int64_t{0}; i < width; ++i) {
+        auto element = createElement({1, 10});
+        tree.leaf = element.get();
+        tree.root->addEntry(std::move(element));
+        tree.root->addEntry(std::make_unique<HSpacer>());
+    }
+    tree.root->updateLayout();
+    return tree;
+}
+
+void resize(benchmark::State &state, Tree tree)
+{
+    for (auto i = 0; auto _ : state) {
+        tree.root->setSize({800.f + i++ % 2, 600});
+        tree.root->updateLayout();
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+void changeLeaf(benchmark::State &state, Tree tree)
+{
+    for (auto i = 0; auto _ : state) {
+        tree.leaf->setSize({10.f + i++ % 2, 10});
+        tree.root->updateLayout();
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+void unchanged(benchmark::State &state, Tree tree)
+{
+    for (auto _ : state) {
+        tree.root->updateLayout();
+        benchmark::DoNotOptimize(tree.root->layoutValid());
+    }
+}
+} // namespace
+
+static void BM_DeepTreeResize(benchmark::State &state)
+{
+    resize(state, createDeepTree(state.range(0)));
+}
+BENCHMARK(BM_DeepTreeResize)->RangeMultiplier(8)->Range(8, 512)->Complexity();
+
+static void BM_DeepTreeLeafChange(benchmark::State &state)
+{
+    changeLeaf(state, createDeepTree(state.range(0)));
+}
+BENCHMARK(BM_DeepTreeLeafChange)->RangeMultiplier(8)->Range(8, 512)->Complexity();
+
+static void BM_WideTreeResize(benchmark::State &state)
+{
+    resize(state, createWideTree(state.range(0)));
+}
+BENCHMARK(BM_WideTreeResize)->RangeMultiplier(8)->Range(8, 32768)->Complexity();
+
+static void BM_WideTreeLeafChange(benchmark::State &state)
+{
+    changeLeaf(state, createWideTree(state.range(0)));
+}
+BENCHMARK(BM_WideTreeLeafChange)->RangeMultiplier(8)->Range(8, 32768)->Complexity();
+
+static void BM_WideTreeUnchanged(benchmark::State &state)
+{
+    unchanged(state, createWideTree(state.range(0)));
+}
+BENCHMARK(BM_WideTreeUnchanged)->RangeMultiplier(8)->Range(8, 32768);
@@ -0,0 +1,42 @@
+#include "AllocationCounter.hpp"
+#include "SeekBar.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+constexpr auto ChapterCount = 50'000;
+
+FilmDetails createFilm()
+{
+    auto details = FilmDetails{.name = "benchmark", .duration = std::chrono::seconds{ChapterCount}};
+    for (auto i = 0; i < ChapterCount; ++i) {
+        auto name = std::pmr::string{"Chapter "};
+        name.append(std::to_string(i)).append(" of the benchmark film");
+        details.chapters.push_back(
+            {.name = std::move(name),
+             .startTime = std::chrono::seconds{i},
+             .endTime = std::chrono::seconds{i + 1}});
+    }
+    return details;
+}
+} // namespace
+
+static void BM_BuildSeekBar(benchmark::State &state)
+{
+    const auto details = createFilm();
+    auto allocations = std::size_t{0};
+    auto bytes = std::size_t{0};
+    for (auto _ : state) {
+        const auto before = allocationStats().allocations;
+        const auto bytesBefore = allocationStats().bytes;
+        auto controller = FilmController{details};
+        auto seekBar = SeekBar{controller};
+        seekBar.setMinimumChapterWidth(0);
+        seekBar.arrange({}, {ChapterCount * 4.f, 16});
+        allocations = allocationStats().allocations - before;
+        bytes = allocationStats().bytes - bytesBefore;
+    }
+    state.counters["allocations"] = double(allocations);
+    state.counters["heapBytesPerChapter"] = double(bytes) / ChapterCount;
+    state.counters["sizeofChapter"] = double(sizeof(Chapter));
+}
+BENCHMARK(BM_BuildSeekBar)->Unit(benchmark::kMillisecond);
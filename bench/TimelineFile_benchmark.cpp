@@ -0,0 +1,111 @@
+#include "AllocationCounter.hpp"
+#include "ChapterFile.hpp"
+#include "TimelineFile.hpp"
+#include <benchmark/benchmark.h>
+#include <format>
+#include <fstream>
+
+namespace {
+constexpr auto ChapterCount = 1'000'000;
+
+FilmDetails createFilm()
+{
+    auto details = FilmDetails{.name = "benchmark", .duration = std::chrono::seconds{ChapterCount}};
+    details.chapters.reserve(ChapterCount);
+    for (auto i = 0; i < ChapterCount; ++i) {
+        auto name = std::pmr::string{"Chapter "};
+        name.append(std::to_string(i)).append(" of the benchmark film");
+        details.chapters.push_back(
+            {.name = std::move(name),
+             .startTime = std::chrono::seconds{i},
+             .endTime = std::chrono::seconds{i + 1}});
+    }
+    return details;
+}
+
+std::string formatTimestamp(std::chrono::milliseconds time)
+{
+    const auto seconds = time.count() / 1000;
+    return std::format("{:02}:{:02}:{:02}.000", seconds / 3600, seconds / 60 % 60, seconds % 60);
+}
+
+// Both files describe the same film, so the benchmarks only differ in how it is loaded.
+struct Files
+{
+    Files()
+    {
+        const auto details = createFilm();
+        TimelineFile::write(timeline, details);
+        auto stream = std::ofstream{webVtt};
+        stream << "WEBVTT\n";
+        for (const auto &chapter : details.chapters) {
+            stream << '\n'
+                   << formatTimestamp(chapter.startTime) << " --> " << formatTimestamp(chapter.endTime) << '\n'
+                   << chapter.name << '\n';
+        }
+    }
+
+    ~Files()
+    {
+        std::filesystem::remove(timeline);
+        std::filesystem::remove(webVtt);
+    }
+
+    std::filesystem::path timeline = std::filesystem::temp_directory_path() / "seekbar_benchmark.timeline";
+    std::filesystem::path webVtt = std::filesystem::temp_directory_path() / "seekbar_benchmark.vtt";
+};
+
+const Files &files()
+{
+    static const auto instance = Files{};
+    return instance;
+}
+
+template<typename Load>
+void measure(benchmark::State &state, const std::filesystem::path &path, Load load)
+{
+    auto heapBytes = std::size_t{0};
+    for (auto _ : state) {
+        const auto before = allocationStats().bytes;
+        auto loaded = load(path);
+        heapBytes = allocationStats().bytes - before;
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetItemsProcessed(state.iterations() * ChapterCount);
+    state.counters["heapBytes"] = benchmark::Counter(double(heapBytes), {}, benchmark::Counter::kIs1024);
+    state.counters["fileBytes"]
+        = benchmark::Counter(double(std::filesystem::file_size(path)), {}, benchmark::Counter::kIs1024);
+}
+} // namespace
+
+static void BM_MapTimeline(benchmark::State &state)
+{
+    measure(state, files().timeline, [](const auto &path) { return TimelineFile::load(path); });
+}
+BENCHMARK(BM_MapTimeline)->Unit(benchmark::kMillisecond);
+
+static void BM_TimelineToChapterDetails(benchmark::State &state)
+{
+    measure(state, files().timeline, [](const auto &path) { return TimelineFile::load(path)->filmDetails(); });
+}
+BENCHMARK(BM_TimelineToChapterDetails)->Unit(benchmark::kMillisecond);
+
+static void BM_TimelineToCopiedSnapshot(benchmark::State &state)
+{
+    measure(state, files().timeline, [](const auto &path) {
+        return FilmDetails::makeShared(TimelineFile::load(path)->filmDetails());
+    });
+}
+BENCHMARK(BM_TimelineToCopiedSnapshot)->Unit(benchmark::kMillisecond);
+
+static void BM_TimelineToSharedSnapshot(benchmark::State &state)
+{
+    measure(state, files().timeline, [](const auto &path) { return TimelineFile::load(path)->sharedFilmDetails(); });
+}
+BENCHMARK(BM_TimelineToSharedSnapshot)->Unit(benchmark::kMillisecond);
+
+static void BM_WebVttToChapterDetails(benchmark::State &state)
+{
+    measure(state, files().webVtt, [](const auto &path) { return ChapterFile::load(path)->filmDetails("benchmark"); });
+}
+BENCHMARK(BM_WebVttToChapterDetails)->Unit(benchmark::kMillisecond);
@@ -1,18 +1,43 @@
 #include "Application.hpp"
 #include "CurrrentTimeLabel.hpp"
+#include "Label.hpp"
 #include "PlayButton.hpp"
 #include "SeekBar.hpp"
 #include "Spacer.hpp"
 
-const auto LoadingStateDuration = sf::seconds(3);
+constexpr auto InputPollInterval = std::chrono::milliseconds{8};
+// Stand in for a network loader and a decoder until the application plays real media.
+constexpr auto SimulatedSegmentSourceSettings = SimulatedSegmentSource::Settings{
+    .startupLatency = std::chrono::seconds{3},
+    .requestLatency = std::chrono::milliseconds{150},
+    .jitter = std::chrono::milliseconds{250},
+    .bandwidth = 8.0};
+constexpr auto BufferingSettings = FilmController::BufferingSettings{
+    .lowWatermark = std::chrono::seconds{2},
+    .highWatermark = std::chrono::seconds{8},
+    .segmentDuration = std::chrono::seconds{5},
+    .readAhead = std::chrono::seconds{30}};
+constexpr auto SimulatedSeekLatency = std::chrono::milliseconds{20};
+constexpr auto SimulatedFastSeekLatency = std::chrono::milliseconds{5};
+constexpr auto MinimumSeekInterval = std::chrono::milliseconds{33};
 
 Application::Application(FilmController &controller)
     : m_filmController{controller}
     , m_contextSettings{{}, {}, 8}
     , m_window{{600, 300}, "SeekBar", sf::Style::Resize | sf::Style::Close, m_contextSettings}
+    , m_segmentSource{SimulatedSegmentSourceSettings}
+    , m_seekBackend{SimulatedSeekLatency}
 {
     m_window.setFramerateLimit(144);
+    m_filmController.setBufferingEnabled(true);
+    m_filmController.setBufferingSettings(BufferingSettings);
+    m_filmController.setSegmentSource(&m_segmentSource);
+    m_seekBackend.setFastLatency(SimulatedFastSeekLatency);
+    m_seekScheduler.setMinimumInterval(MinimumSeekInterval);
+    m_seekCompletedConnection = m_seekScheduler.onSeekCompleted(
+        [this](auto target) { m_filmController.jumpTo(target.time, target.mode); });
     setupUi();
+    Label::prewarmGlyphs();
 }
 
 void Application::setupUi()
@@ -21,51 +46,137 @@ void Application::setupUi()
     m_mainLayout.setSpacing(4);
     m_mainLayout.setPadding(10);
     m_mainLayout.addEntry(std::make_unique<VSpacer>());
-    m_mainLayout.addEntry(std::make_unique<SeekBar>(m_filmController));
-    auto hLayout = std::make_unique<Layout>(Orientation::Horizontal);
+    auto seekBar = std::make_unique<SeekBar>(m_filmController);
+    seekBar->setSeekScheduler(&m_seekScheduler);
+    m_mainLayout.addEntry(std::move(seekBar));
+    auto hLayout = std::make_unique<Layout>(Orientation::Horizontal, m_uiArena.resource());
     hLayout->setSize({0, 20});
+    hLayout->setFillWidth(true);
+    hLayout->setFillHeight(false);
     hLayout->addEntry(std::make_unique<PlayButton>(m_filmController));
     hLayout->addEntry(std::make_unique<HSpacer>(20));
     hLayout->addEntry(std::make_unique<CurrentTimeLabel>(m_filmController));
     hLayout->addEntry(std::make_unique<HSpacer>());
     m_mainLayout.addEntry(std::move(hLayout));
     m_mainLayout.show();
+    m_tree.rebuild(m_mainLayout);
+}
+
+Application::RenderMode Application::renderMode() const
+{
+    return m_framePacer.renderMode();
+}
+
+void Application::setRenderMode(RenderMode renderMode)
+{
+    m_framePacer.setRenderMode(renderMode);
+}
+
+const Application::FrameStats &Application::frameStats() const
+{
+    return m_framePacer.stats();
+}
+
+const InputQueue::Stats &Application::inputStats() const
+{
+    return m_input.stats();
+}
+
+const SeekScheduler::Stats &Application::seekStats() const
+{
+    return m_seekScheduler.stats();
 }
 
 void Application::run()
 {
-    sf::Clock loadingClock;
+    auto wakeUpEvent = std::optional<sf::Event>{};
     while (m_window.isOpen()) {
-        for (auto event = sf::Event(); m_window.pollEvent(event);) {
-            const auto mousePosition = sf::Mouse::getPosition(m_window);
-            if (event.type == sf::Event::Closed) {
-                m_window.close();
-            } else if (event.type == sf::Event::MouseMoved) {
-                m_mainLayout.handleMouseMoved(mousePosition);
-            } else if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-                m_mainLayout.handleMousePressed(mousePosition);
-            } else if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
-                m_mainLayout.handleMouseReleased(mousePosition);
-            } else if (event.type == sf::Event::KeyPressed) {
-                if (event.key.code == sf::Keyboard::Left) {
-                    m_filmController.jumpBackward();
-                } else if (event.key.code == sf::Keyboard::Right) {
-                    m_filmController.jumpForward();
-                } else if (event.key.code == sf::Keyboard::Space && !m_filmController.loading()) {
-                    if (m_filmController.playing()) {
-                        m_filmController.pause();
-                    } else {
-                        m_filmController.play();
-                    }
-                }
+        {
+            const auto batch = m_filmController.batch();
+            if (wakeUpEvent) {
+                m_input.push(*wakeUpEvent);
+            }
+            for (auto event = sf::Event(); m_window.pollEvent(event);) {
+                m_input.push(event);
             }
+            m_input.deliver([this](const sf::Event &event) { handleEvent(event); });
+            m_seekScheduler.update();
+            m_filmController.update();
         }
-        if (loadingClock.getElapsedTime() > LoadingStateDuration && m_filmController.loading()) {
-            m_filmController.pause();
+        m_tree.updateLayout();
+        render();
+        wakeUpEvent = waitForWakeUp();
+    }
+}
+
+void Application::handleEvent(const sf::Event &event)
+{
+    if (event.type == sf::Event::Closed) {
+        m_window.close();
+    } else if (event.type == sf::Event::Resized) {
+        const auto size = sf::Vector2f{float(event.size.width), float(event.size.height)};
+        m_window.setView(sf::View{sf::FloatRect{{0, 0}, size}});
+        m_mainLayout.setSize(size);
+    } else if (event.type == sf::Event::GainedFocus) {
+        m_mainLayout.markDirty();
+    } else if (event.type == sf::Event::MouseMoved) {
+        m_tree.handleMouseMoved({event.mouseMove.x, event.mouseMove.y});
+    } else if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+        m_tree.handleMousePressed({event.mouseButton.x, event.mouseButton.y});
+    } else if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
+        m_tree.handleMouseReleased({event.mouseButton.x, event.mouseButton.y});
+    } else if (event.type == sf::Event::MouseWheelScrolled) {
+        m_tree.handleMouseWheelScrolled(
+            {event.mouseWheelScroll.x, event.mouseWheelScroll.y},
+            event.mouseWheelScroll.wheel,
+            event.mouseWheelScroll.delta);
+    } else if (event.type == sf::Event::KeyPressed) {
+        // Repeated presses step from the seek still pending, not from the time the film has not reached yet.
+        const auto from = m_seekScheduler.target().value_or(m_filmController.currentTime());
+        if (event.key.code == sf::Keyboard::Left && m_filmController.seekable()) {
+            m_seekScheduler.request(m_filmController.backwardJumpTarget(from));
+        } else if (event.key.code == sf::Keyboard::Right && m_filmController.seekable()) {
+            m_seekScheduler.request(m_filmController.forwardJumpTarget(from));
+        } else if (event.key.code == sf::Keyboard::Space && !m_filmController.loading()) {
+            if (m_filmController.playing()) {
+                m_filmController.pause();
+            } else {
+                m_filmController.play();
+            }
         }
-        m_filmController.update();
-        m_window.clear(sf::Color{37, 38, 40});
-        m_window.draw(m_mainLayout);
-        m_window.display();
     }
+}
+
+std::optional<sf::Event> Application::waitForWakeUp()
+{
+    m_scheduler.reset();
+    m_mainLayout.scheduleWakeUp(m_scheduler);
+    m_seekScheduler.scheduleWakeUp(m_scheduler);
+    m_segmentSource.scheduleWakeUp(m_scheduler);
+    auto event = sf::Event{};
+    const auto wakeUp = m_scheduler.nextWakeUp();
+    if (!wakeUp) {
+        return m_window.waitEvent(event) ? std::optional{event} : std::nullopt;
+    }
+    // SFML 2.6 has no waitEvent with a timeout, so poll in short slices until the deadline.
+    while (Scheduler::Clock::now() < *wakeUp) {
+        if (m_window.pollEvent(event)) {
+            return event;
+        }
+        const auto slice = std::min<Scheduler::Clock::duration>(*wakeUp - Scheduler::Clock::now(), InputPollInterval);
+        sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(slice).count()));
+    }
+    return std::nullopt;
+}
+
+bool Application::render()
+{
+    if (!m_framePacer.beginFrame(m_mainLayout)) {
+        return false;
+    }
+    m_window.clear(sf::Color{37, 38, 40});
+    m_window.draw(m_tree);
+    m_window.display();
+    m_framePacer.endFrame(m_mainLayout, m_startupClock.getElapsedTime());
+    return true;
 }
\ No newline at end of file
@@ -1,21 +1,51 @@
 #pragma once
 
+#include "Arena.hpp"
 #include "FilmController.hpp"
+#include "FlatTree.hpp"
+#include "FramePacer.hpp"
+#include "InputQueue.hpp"
 #include "Layout.hpp"
+#include "Scheduler.hpp"
+#include "SeekScheduler.hpp"
+#include "SegmentSource.hpp"
 #include <SFML/Graphics.hpp>
+#include <optional>
 
 class Application
 {
 public:
+    using RenderMode = FramePacer::RenderMode;
+    using FrameStats = FramePacer::Stats;
+
     explicit Application(FilmController &controller);
 
+    RenderMode renderMode() const;
+    void setRenderMode(RenderMode renderMode);
+    const FrameStats &frameStats() const;
+    const InputQueue::Stats &inputStats() const;
+    const SeekScheduler::Stats &seekStats() const;
+
     void run();
 
 private:
     void setupUi();
+    void handleEvent(const sf::Event &event);
+    std::optional<sf::Event> waitForWakeUp();
+    bool render();
 
     FilmController &m_filmController;
+    sf::Clock m_startupClock;
     sf::ContextSettings m_contextSettings;
     sf::RenderWindow m_window;
-    Layout m_mainLayout{Orientation::Vertical};
+    SimulatedSegmentSource m_segmentSource;
+    SimulatedSeekBackend m_seekBackend;
+    SeekScheduler m_seekScheduler{m_seekBackend};
+    ScopedConnection m_seekCompletedConnection;
+    Arena m_uiArena;
+    Layout m_mainLayout{Orientation::Vertical, m_uiArena.resource()};
+    FlatTree m_tree;
+    InputQueue m_input;
+    Scheduler m_scheduler;
+    FramePacer m_framePacer;
 };
@@ -0,0 +1,15 @@
+#include "Arena.hpp"
+
+Arena::Arena(std::size_t initialSize)
+    : m_resource{initialSize}
+{}
+
+std::pmr::memory_resource *Arena::resource()
+{
+    return &m_resource;
+}
+
+void Arena::reset()
+{
+    m_resource.release();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+
+class Arena
+{
+public:
+    struct Deleter
+    {
+        template<typename T>
+        void operator()(T *object) const { std::destroy_at(object); }
+    };
+
+    template<typename T>
+    using Pointer = std::unique_ptr<T, Deleter>;
+
+    explicit Arena(std::size_t initialSize = 4096);
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    std::pmr::memory_resource *resource();
+
+    template<typename T, typename... Args>
+    Pointer<T> make(Args &&...args)
+    {
+        return Pointer<T>{std::pmr::polymorphic_allocator<>{&m_resource}.new_object<T>(std::forward<Args>(args)...)};
+    }
+
+    void reset();
+
+private:
+    std::pmr::monotonic_buffer_resource m_resource;
+};
@@ -0,0 +1,572 @@
+#include "ChapterFile.hpp"
+#include <algorithm>
+#include <format>
+
+namespace {
+using Error = ChapterFile::Error;
+
+bool isDigit(char character)
+{
+    return character >= '0' && character <= '9';
+}
+
+bool isSpace(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+}
+
+std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && isSpace(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isSpace(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+std::string_view nextLine(std::string_view &text)
+{
+    const auto end = text.find('\n');
+    auto line = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+    if (line.ends_with('\r')) {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+std::string formatTimestamp(std::chrono::milliseconds time)
+{
+    const auto count = time.count();
+    return std::format(
+        "{:02}:{:02}:{:02}.{:03}", count / 3'600'000, count / 60'000 % 60, count / 1000 % 60, count % 1000);
+}
+
+// Parses [[hh:]mm:]ss[.fff] from the front of text. A lone seconds field may exceed 59, which lets JSON
+// files use plain numbers of seconds.
+std::optional<std::chrono::milliseconds> consumeTimestamp(std::string_view &text)
+{
+    std::int64_t fields[3]{};
+    auto fieldCount = 0;
+    auto position = std::size_t{0};
+    for (;;) {
+        const auto start = position;
+        auto value = std::int64_t{0};
+        for (; position < text.size() && isDigit(text[position]); ++position) {
+            if (position - start == 10) {
+                return std::nullopt;
+            }
+            value = value * 10 + (text[position] - '0');
+        }
+        if (position == start || fieldCount == 3) {
+            return std::nullopt;
+        }
+        fields[fieldCount++] = value;
+        if (position == text.size() || text[position] != ':') {
+            break;
+        }
+        ++position;
+    }
+    if ((fieldCount > 1 && fields[fieldCount - 1] >= 60) || (fieldCount > 2 && fields[1] >= 60)) {
+        return std::nullopt;
+    }
+    auto milliseconds = std::int64_t{0};
+    if (position < text.size() && text[position] == '.') {
+        const auto start = ++position;
+        for (auto scale = 100; position < text.size() && isDigit(text[position]); ++position, scale /= 10) {
+            milliseconds += (text[position] - '0') * scale;
+        }
+        if (position == start) {
+            return std::nullopt;
+        }
+    }
+    auto seconds = std::int64_t{0};
+    for (auto i = 0; i < fieldCount; ++i) {
+        seconds = seconds * 60 + fields[i];
+    }
+    text.remove_prefix(position);
+    return std::chrono::milliseconds{seconds * 1000 + milliseconds};
+}
+
+class Parser
+{
+public:
+    explicit Parser(std::string_view text)
+        : m_text{text}
+    {
+        m_chapters.reserve(text.size() / 48);
+    }
+
+    std::unexpected<Error> error(Error::Code code, const char *position, std::string message) const
+    {
+        return std::unexpected{Error{
+            .code = code,
+            .line = std::size_t(std::count(m_text.data(), position, '\n')) + 1,
+            .message = std::move(message)}};
+    }
+
+    std::expected<void, Error> add(
+        std::string_view name,
+        std::chrono::milliseconds startTime,
+        std::chrono::milliseconds endTime,
+        const char *position)
+    {
+        if (endTime <= startTime) {
+            return error(
+                Error::Code::InvalidRange,
+                position,
+                std::format(
+                    "chapter \"{}\" ends at {}, which is not after its start at {}",
+                    name,
+                    formatTimestamp(endTime),
+                    formatTimestamp(startTime)));
+        }
+        if (!m_chapters.empty() && startTime < m_chapters.back().startTime) {
+            return error(
+                Error::Code::Unsorted,
+                position,
+                std::format(
+                    "chapter \"{}\" starts at {}, before the previous chapter \"{}\" starts at {}",
+                    name,
+                    formatTimestamp(startTime),
+                    m_chapters.back().name,
+                    formatTimestamp(m_chapters.back().startTime)));
+        }
+        if (!m_chapters.empty() && startTime < m_chapters.back().endTime) {
+            return error(
+                Error::Code::Overlapping,
+                position,
+                std::format(
+                    "chapter \"{}\" starts at {}, before the previous chapter \"{}\" ends at {}",
+                    name,
+                    formatTimestamp(startTime),
+                    m_chapters.back().name,
+                    formatTimestamp(m_chapters.back().endTime)));
+        }
+        m_chapters.push_back({.name = name, .startTime = startTime, .endTime = endTime});
+        return {};
+    }
+
+    std::vector<ChapterFile::Chapter> takeChapters() { return std::move(m_chapters); }
+
+private:
+    std::string_view m_text;
+    std::vector<ChapterFile::Chapter> m_chapters;
+};
+
+std::expected<std::vector<ChapterFile::Chapter>, Error> parseWebVtt(std::string_view text)
+{
+    auto parser = Parser{text};
+    auto rest = text;
+    if (rest.starts_with("\xEF\xBB\xBF")) {
+        rest.remove_prefix(3);
+    }
+    const auto header = nextLine(rest);
+    if (!header.starts_with("WEBVTT") || (header.size() > 6 && header[6] != ' ' && header[6] != '\t')) {
+        return parser.error(Error::Code::Malformed, header.data(), "missing WEBVTT header");
+    }
+    while (!rest.empty() && !nextLine(rest).empty()) {
+    }
+    while (!rest.empty()) {
+        auto line = nextLine(rest);
+        if (line.empty()) {
+            continue;
+        }
+        if (line.find("-->") == std::string_view::npos) {
+            if (line.starts_with("NOTE") || line.starts_with("STYLE") || line.starts_with("REGION") || rest.empty()) {
+                while (!rest.empty() && !nextLine(rest).empty()) {
+                }
+                continue;
+            }
+            line = nextLine(rest);
+        }
+        const auto *const timingLine = line.data();
+        const auto startTime = consumeTimestamp(line);
+        if (!startTime) {
+            return parser.error(Error::Code::Malformed, timingLine, "invalid cue start timestamp");
+        }
+        line = trim(line);
+        if (!line.starts_with("-->")) {
+            return parser.error(Error::Code::Malformed, timingLine, "expected \"-->\" after the cue start timestamp");
+        }
+        line = trim(line.substr(3));
+        const auto endTime = consumeTimestamp(line);
+        if (!endTime || (!line.empty() && !isSpace(line.front()))) {
+            return parser.error(Error::Code::Malformed, timingLine, "invalid cue end timestamp");
+        }
+        const auto name = rest.empty() ? std::string_view{} : nextLine(rest);
+        while (!rest.empty() && !nextLine(rest).empty()) {
+        }
+        if (auto added = parser.add(trim(name), *startTime, *endTime, timingLine); !added) {
+            return std::unexpected{std::move(added.error())};
+        }
+    }
+    return parser.takeChapters();
+}
+
+std::expected<std::vector<ChapterFile::Chapter>, Error> parseCsv(std::string_view text)
+{
+    auto parser = Parser{text};
+    auto rest = text;
+    for (auto first = true; !rest.empty(); first = false) {
+        const auto line = nextLine(rest);
+        const auto fields = trim(line);
+        if (fields.empty() || (first && !isDigit(fields.front()))) {
+            continue;
+        }
+        const auto startEnd = fields.find(',');
+        const auto endEnd = fields.find(',', startEnd == std::string_view::npos ? startEnd : startEnd + 1);
+        if (endEnd == std::string_view::npos) {
+            return parser.error(Error::Code::Malformed, line.data(), "expected \"start,end,name\"");
+        }
+        const auto startTime = ChapterFile::parseTimestamp(trim(fields.substr(0, startEnd)));
+        const auto endTime = ChapterFile::parseTimestamp(trim(fields.substr(startEnd + 1, endEnd - startEnd - 1)));
+        if (!startTime || !endTime) {
+            return parser.error(Error::Code::Malformed, line.data(), "invalid timestamp");
+        }
+        auto name = trim(fields.substr(endEnd + 1));
+        if (name.size() >= 2 && name.front() == '"' && name.back() == '"') {
+            name = name.substr(1, name.size() - 2);
+        }
+        if (auto added = parser.add(name, *startTime, *endTime, line.data()); !added) {
+            return std::unexpected{std::move(added.error())};
+        }
+    }
+    return parser.takeChapters();
+}
+
+class JsonReader
+{
+public:
+    JsonReader(Parser &parser, std::string_view text)
+        : m_parser{parser}
+        , m_position{text.data()}
+        , m_end{text.data() + text.size()}
+    {}
+
+    std::expected<void, Error> parse()
+    {
+        skipSpace();
+        auto parsed = peek() == '[' ? parseChapters() : parseObject();
+        if (!parsed) {
+            return parsed;
+        }
+        skipSpace();
+        if (m_position != m_end) {
+            return error("unexpected content after the chapters");
+        }
+        return {};
+    }
+
+private:
+    std::expected<void, Error> parseObject()
+    {
+        if (!consume('{')) {
+            return error("expected an object or an array of chapters");
+        }
+        for (auto first = true; !consume('}'); first = false) {
+            if (!first && !consume(',')) {
+                return error("expected ',' or '}'");
+            }
+            const auto key = parseString();
+            if (!key) {
+                return std::unexpected{key.error()};
+            }
+            if (!consume(':')) {
+                return error("expected ':'");
+            }
+            if (*key == "chapters") {
+                if (auto chapters = parseChapters(); !chapters) {
+                    return chapters;
+                }
+            } else if (auto skipped = skipValue(); !skipped) {
+                return skipped;
+            }
+        }
+        return {};
+    }
+
+    std::expected<void, Error> parseChapters()
+    {
+        if (!consume('[')) {
+            return error("expected an array of chapters");
+        }
+        for (auto first = true; !consume(']'); first = false) {
+            if (!first && !consume(',')) {
+                return error("expected ',' or ']'");
+            }
+            if (auto chapter = parseChapter(); !chapter) {
+                return chapter;
+            }
+        }
+        return {};
+    }
+
+    std::expected<void, Error> parseChapter()
+    {
+        skipSpace();
+        const auto *const start = m_position;
+        if (!consume('{')) {
+            return error("expected a chapter object");
+        }
+        auto name = std::string_view{};
+        auto startTime = std::optional<std::chrono::milliseconds>{};
+        auto endTime = std::optional<std::chrono::milliseconds>{};
+        for (auto first = true; !consume('}'); first = false) {
+            if (!first && !consume(',')) {
+                return error("expected ',' or '}'");
+            }
+            const auto key = parseString();
+            if (!key) {
+                return std::unexpected{key.error()};
+            }
+            if (!consume(':')) {
+                return error("expected ':'");
+            }
+            if (*key == "name" || *key == "title") {
+                const auto value = parseString();
+                if (!value) {
+                    return std::unexpected{value.error()};
+                }
+                name = *value;
+            } else if (*key == "start" || *key == "end") {
+                const auto time = parseTime();
+                if (!time) {
+                    return std::unexpected{time.error()};
+                }
+                (*key == "start" ? startTime : endTime) = *time;
+            } else if (auto skipped = skipValue(); !skipped) {
+                return skipped;
+            }
+        }
+        if (!startTime || !endTime) {
+            return m_parser.error(Error::Code::Malformed, start, "chapter is missing \"start\" or \"end\"");
+        }
+        return m_parser.add(name, *startTime, *endTime, start);
+    }
+
+    std::expected<std::chrono::milliseconds, Error> parseTime()
+    {
+        skipSpace();
+        auto text = std::string_view{};
+        if (peek() == '"') {
+            const auto value = parseString();
+            if (!value) {
+                return std::unexpected{value.error()};
+            }
+            text = *value;
+        } else {
+            const auto *const start = m_position;
+            while (m_position != m_end && (isDigit(*m_position) || *m_position == '.')) {
+                ++m_position;
+            }
+            text = {start, m_position};
+        }
+        if (const auto time = ChapterFile::parseTimestamp(text)) {
+            return *time;
+        }
+        return error("invalid timestamp");
+    }
+
+    std::expected<std::string_view, Error> parseString()
+    {
+        if (!consume('"')) {
+            return error("expected a string");
+        }
+        const auto *const start = m_position;
+        for (; m_position != m_end && *m_position != '"'; ++m_position) {
+            if (*m_position == '\\') {
+                return error("escape sequences in strings are not supported");
+            }
+        }
+        if (m_position == m_end) {
+            return error("unterminated string");
+        }
+        return std::string_view{start, m_position++};
+    }
+
+    std::expected<void, Error> skipValue()
+    {
+        skipSpace();
+        auto depth = 0;
+        do {
+            if (m_position == m_end) {
+                return error("unexpected end of file");
+            }
+            if (*m_position == '"') {
+                if (const auto skipped = parseString(); !skipped) {
+                    return std::unexpected{skipped.error()};
+                }
+                continue;
+            }
+            if (*m_position == '{' || *m_position == '[') {
+                ++depth;
+            } else if (*m_position == '}' || *m_position == ']') {
+                if (depth == 0) {
+                    break;
+                }
+                --depth;
+            } else if (depth == 0 && *m_position == ',') {
+                break;
+            }
+            ++m_position;
+        } while (depth > 0
+                 || (m_position != m_end && *m_position != ',' && *m_position != '}' && *m_position != ']'));
+        return {};
+    }
+
+    void skipSpace()
+    {
+        while (m_position != m_end && isSpace(*m_position)) {
+            ++m_position;
+        }
+    }
+
+    char peek() const { return m_position == m_end ? '\0' : *m_position; }
+
+    bool consume(char character)
+    {
+        skipSpace();
+        if (peek() != character) {
+            return false;
+        }
+        ++m_position;
+        return true;
+    }
+
+    std::unexpected<Error> error(std::string message) const
+    {
+        return m_parser.error(Error::Code::Malformed, m_position, std::move(message));
+    }
+
+    Parser &m_parser;
+    const char *m_position;
+    const char *m_end;
+};
+
+std::expected<std::vector<ChapterFile::Chapter>, Error> parseJson(std::string_view text)
+{
+    auto parser = Parser{text};
+    if (auto parsed = JsonReader{parser, text}.parse(); !parsed) {
+        return std::unexpected{std::move(parsed.error())};
+    }
+    return parser.takeChapters();
+}
+} // namespace
+
+std::string ChapterFile::Error::describe() const
+{
+    return line == 0 ? message : std::format("line {}: {}", line, message);
+}
+
+std::expected<ChapterFile, ChapterFile::Error> ChapterFile::load(const std::filesystem::path &path)
+{
+    auto file = MappedFile::open(path);
+    if (!file) {
+        return std::unexpected{Error{
+            .code = Error::Code::OpenFailed,
+            .message = std::format("cannot open {}: {}", path.string(), file.error().message())}};
+    }
+    auto chapterFile = ChapterFile{};
+    chapterFile.m_file = std::move(*file);
+    const auto text = chapterFile.m_file.contents();
+    auto chapters = parse(text, detectFormat(path, text));
+    if (!chapters) {
+        return std::unexpected{std::move(chapters.error())};
+    }
+    chapterFile.m_chapters = std::move(*chapters);
+    return chapterFile;
+}
+
+std::expected<std::vector<ChapterFile::Chapter>, ChapterFile::Error> ChapterFile::parse(
+    std::string_view text, Format format)
+{
+    auto chapters = std::expected<std::vector<Chapter>, Error>{};
+    switch (format) {
+    case Format::WebVtt:
+        chapters = parseWebVtt(text);
+        break;
+    case Format::Json:
+        chapters = parseJson(text);
+        break;
+    case Format::Csv:
+        chapters = parseCsv(text);
+        break;
+    }
+    if (chapters && chapters->empty()) {
+        return std::unexpected{Error{.code = Error::Code::Empty, .message = "the file contains no chapters"}};
+    }
+    return chapters;
+}
+
+ChapterFile::Format ChapterFile::detectFormat(const std::filesystem::path &path, std::string_view text)
+{
+    const auto extension = path.extension();
+    if (extension == ".vtt") {
+        return Format::WebVtt;
+    }
+    if (extension == ".json") {
+        return Format::Json;
+    }
+    if (extension == ".csv") {
+        return Format::Csv;
+    }
+    text = trim(text);
+    if (text.starts_with("\xEF\xBB\xBF")) {
+        text.remove_prefix(3);
+    }
+    if (text.starts_with("WEBVTT")) {
+        return Format::WebVtt;
+    }
+    if (text.starts_with('{') || text.starts_with('[')) {
+        return Format::Json;
+    }
+    return Format::Csv;
+}
+
+std::optional<std::chrono::milliseconds> ChapterFile::parseTimestamp(std::string_view text)
+{
+    const auto time = consumeTimestamp(text);
+    return time && text.empty() ? time : std::nullopt;
+}
+
+const std::vector<ChapterFile::Chapter> &ChapterFile::chapters() const
+{
+    return m_chapters;
+}
+
+std::chrono::milliseconds ChapterFile::duration() const
+{
+    return m_chapters.empty() ? std::chrono::milliseconds{} : m_chapters.back().endTime;
+}
+
+FilmDetails ChapterFile::filmDetails(std::string_view name, const std::pmr::polymorphic_allocator<> &allocator) const
+{
+    auto details = FilmDetails{
+        .name = std::pmr::string{name, allocator},
+        .duration = duration(),
+        .chapters = std::pmr::vector<FilmDetails::ChapterDetails>{allocator},
+        .keyframes = KeyframeIndex{allocator}};
+    details.chapters.reserve(m_chapters.size());
+    for (const auto &chapter : m_chapters) {
+        details.chapters.push_back(
+            {.name = std::pmr::string{chapter.name, allocator},
+             .startTime = chapter.startTime,
+             .endTime = chapter.endTime});
+    }
+    return details;
+}
+
+std::shared_ptr<FilmDetails> ChapterFile::sharedFilmDetails(std::string_view name) const
+{
+    auto initialSize = sizeof(FilmDetails::ChapterDetails) * m_chapters.size() + name.size() + 1;
+    for (const auto &chapter : m_chapters) {
+        initialSize += chapter.name.size() + 1;
+    }
+    auto details = FilmDetails::allocateShared(initialSize);
+    // Built with the arena's allocator, so moving the copy in takes over its storage.
+    *details = filmDetails(name, details->chapters.get_allocator());
+    return details;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "FilmDetails.hpp"
+#include "MappedFile.hpp"
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ChapterFile
+{
+public:
+    enum class Format { WebVtt, Json, Csv };
+
+    struct Chapter
+    {
+        std::string_view name;
+        std::chrono::milliseconds startTime{};
+        std::chrono::milliseconds endTime{};
+    };
+
+    struct Error
+    {
+        enum class Code { OpenFailed, Malformed, Empty, InvalidRange, Unsorted, Overlapping };
+
+        Code code{};
+        std::size_t line{};
+        std::string message;
+
+        std::string describe() const;
+    };
+
+    static std::expected<ChapterFile, Error> load(const std::filesystem::path &path);
+    static std::expected<std::vector<Chapter>, Error> parse(std::string_view text, Format format);
+    static Format detectFormat(const std::filesystem::path &path, std::string_view text);
+    static std::optional<std::chrono::milliseconds> parseTimestamp(std::string_view text);
+
+    const std::vector<Chapter> &chapters() const;
+    std::chrono::milliseconds duration() const;
+    FilmDetails filmDetails(std::string_view name, const std::pmr::polymorphic_allocator<> &allocator = {}) const;
+    // The same copy made straight into a FilmDetails::allocateShared arena sized for it, ready for FilmController.
+    std::shared_ptr<FilmDetails> sharedFilmDetails(std::string_view name) const;
+
+private:
+    MappedFile m_file;
+    std::vector<Chapter> m_chapters;
+};
@@ -0,0 +1,56 @@
+#include "ChapterIndex.hpp"
+#include <algorithm>
+
+ChapterIndex::ChapterIndex(std::span<const FilmDetails::ChapterDetails> chapters)
+{
+    m_startTimes.reserve(chapters.size());
+    m_endTimes.reserve(chapters.size());
+    for (const auto &chapter : chapters) {
+        m_startTimes.push_back(chapter.startTime);
+        m_endTimes.push_back(chapter.endTime);
+    }
+}
+
+ChapterIndex::ChapterIndex(
+    std::vector<std::chrono::milliseconds> startTimes, std::vector<std::chrono::milliseconds> endTimes)
+    : m_startTimes{std::move(startTimes)}
+    , m_endTimes{std::move(endTimes)}
+{}
+
+std::size_t ChapterIndex::size() const
+{
+    return m_startTimes.size();
+}
+
+bool ChapterIndex::empty() const
+{
+    return m_startTimes.empty();
+}
+
+std::chrono::milliseconds ChapterIndex::startTime(std::size_t index) const
+{
+    return m_startTimes[index];
+}
+
+std::chrono::milliseconds ChapterIndex::endTime(std::size_t index) const
+{
+    return m_endTimes[index];
+}
+
+std::optional<std::size_t> ChapterIndex::chapterAt(std::chrono::milliseconds time) const
+{
+    const auto it = std::ranges::upper_bound(m_startTimes, time);
+    if (it == std::cbegin(m_startTimes)) {
+        return std::nullopt;
+    }
+    const auto index = std::size_t(std::distance(std::cbegin(m_startTimes), it) - 1);
+    if (time >= m_endTimes[index]) {
+        return std::nullopt;
+    }
+    return index;
+}
+
+std::size_t ChapterIndex::filledCount(std::chrono::milliseconds time) const
+{
+    return std::size_t(std::distance(std::cbegin(m_endTimes), std::ranges::upper_bound(m_endTimes, time)));
+}
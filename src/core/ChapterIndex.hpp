@@ -0,0 +1,25 @@
+#pragma once
+
+#include "FilmDetails.hpp"
+#include <optional>
+#include <span>
+
+class ChapterIndex
+{
+public:
+    ChapterIndex() = default;
+    explicit ChapterIndex(std::span<const FilmDetails::ChapterDetails> chapters);
+    ChapterIndex(std::vector<std::chrono::milliseconds> startTimes, std::vector<std::chrono::milliseconds> endTimes);
+
+    std::size_t size() const;
+    bool empty() const;
+    std::chrono::milliseconds startTime(std::size_t index) const;
+    std::chrono::milliseconds endTime(std::size_t index) const;
+
+    std::optional<std::size_t> chapterAt(std::chrono::milliseconds time) const;
+    std::size_t filledCount(std::chrono::milliseconds time) const;
+
+private:
+    std::vector<std::chrono::milliseconds> m_startTimes;
+    std::vector<std::chrono::milliseconds> m_endTimes;
+};
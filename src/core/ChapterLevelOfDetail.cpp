@@ -0,0 +1,37 @@
+#include "ChapterLevelOfDetail.hpp"
+#include <algorithm>
+
+ChapterLevelOfDetail::ChapterLevelOfDetail(std::span<const FilmDetails::ChapterDetails> chapters)
+{
+    m_startTimes.reserve(chapters.size());
+    m_endTimes.reserve(chapters.size());
+    for (const auto &chapter : chapters) {
+        m_startTimes.push_back(chapter.startTime);
+        m_endTimes.push_back(chapter.endTime);
+    }
+}
+
+std::vector<ChapterLevelOfDetail::Segment> ChapterLevelOfDetail::segments(
+    float width, std::chrono::milliseconds from, std::chrono::milliseconds to, float minimumWidth) const
+{
+    auto segments = std::vector<Segment>{};
+    if (width <= 0 || to <= from) {
+        return segments;
+    }
+    const auto minimumDuration = std::chrono::milliseconds{std::int64_t(minimumWidth * (to - from).count() / width)};
+    auto first = std::size_t(std::distance(std::cbegin(m_endTimes), std::ranges::upper_bound(m_endTimes, from)));
+    while (first < m_startTimes.size() && m_startTimes[first] < to) {
+        const auto it = std::lower_bound(
+            std::next(std::cbegin(m_endTimes), std::ptrdiff_t(first)),
+            std::cend(m_endTimes),
+            std::max(m_startTimes[first], from) + minimumDuration);
+        const auto last = std::min(std::size_t(std::distance(std::cbegin(m_endTimes), it)), m_endTimes.size() - 1);
+        segments.push_back(
+            {.firstChapter = first,
+             .lastChapter = last,
+             .startTime = m_startTimes[first],
+             .endTime = m_endTimes[last]});
+        first = last + 1;
+    }
+    return segments;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "FilmDetails.hpp"
+#include <span>
+
+class ChapterLevelOfDetail
+{
+public:
+    struct Segment
+    {
+        std::size_t firstChapter{};
+        std::size_t lastChapter{};
+        std::chrono::milliseconds startTime{};
+        std::chrono::milliseconds endTime{};
+
+        bool aggregated() const { return firstChapter != lastChapter; }
+    };
+
+    ChapterLevelOfDetail() = default;
+    explicit ChapterLevelOfDetail(std::span<const FilmDetails::ChapterDetails> chapters);
+
+    std::vector<Segment> segments(
+        float width, std::chrono::milliseconds from, std::chrono::milliseconds to, float minimumWidth) const;
+
+private:
+    std::vector<std::chrono::milliseconds> m_startTimes;
+    std::vector<std::chrono::milliseconds> m_endTimes;
+};
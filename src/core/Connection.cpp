@@ -0,0 +1,54 @@
+#include "Connection.hpp"
+#include <utility>
+
+Connection::Connection(std::weak_ptr<SignalState> state, std::uint64_t id)
+    : m_state{std::move(state)}
+    , m_id{id}
+{}
+
+bool Connection::connected() const
+{
+    const auto state = m_state.lock();
+    return state && state->connected(m_id);
+}
+
+void Connection::disconnect()
+{
+    if (const auto state = m_state.lock()) {
+        state->disconnect(m_id);
+    }
+    m_state.reset();
+}
+
+ScopedConnection::ScopedConnection(Connection &&connection)
+    : m_connection{std::move(connection)}
+{}
+
+ScopedConnection &ScopedConnection::operator=(ScopedConnection &&other) noexcept
+{
+    if (this != &other) {
+        disconnect();
+        m_connection = other.release();
+    }
+    return *this;
+}
+
+ScopedConnection::~ScopedConnection()
+{
+    disconnect();
+}
+
+bool ScopedConnection::connected() const
+{
+    return m_connection.connected();
+}
+
+void ScopedConnection::disconnect()
+{
+    m_connection.disconnect();
+}
+
+Connection ScopedConnection::release()
+{
+    return std::exchange(m_connection, {});
+}
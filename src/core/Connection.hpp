@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+class SignalState
+{
+public:
+    virtual ~SignalState() = default;
+
+    virtual bool connected(std::uint64_t id) const = 0;
+    virtual void disconnect(std::uint64_t id) = 0;
+};
+
+class Connection
+{
+public:
+    Connection() = default;
+    Connection(std::weak_ptr<SignalState> state, std::uint64_t id);
+
+    bool connected() const;
+    void disconnect();
+
+private:
+    std::weak_ptr<SignalState> m_state;
+    std::uint64_t m_id{};
+};
+
+class ScopedConnection
+{
+public:
+    ScopedConnection() = default;
+    ScopedConnection(Connection &&connection);
+    ScopedConnection(ScopedConnection &&other) noexcept = default;
+    ScopedConnection &operator=(ScopedConnection &&other) noexcept;
+    ScopedConnection(const ScopedConnection &) = delete;
+    ScopedConnection &operator=(const ScopedConnection &) = delete;
+    ~ScopedConnection();
+
+    bool connected() const;
+    void disconnect();
+    Connection release();
+
+private:
+    Connection m_connection;
+};
@@ -1,22 +1,43 @@
 #include "FilmController.hpp"
+#include <algorithm>
 #include <numeric>
+#include <utility>
 
 constexpr auto JumpInterval = std::chrono::seconds{10};
 
-FilmController::FilmController(const FilmDetails &details)
-    : m_filmDetails{details}
+FilmController::FilmController(const FilmDetails &details, std::shared_ptr<TimeSource> timeSource)
+    : FilmController{FilmDetails::makeShared(details), std::move(timeSource)}
 {}
 
+FilmController::FilmController(std::shared_ptr<const FilmDetails> details, std::shared_ptr<TimeSource> timeSource)
+    : m_filmDetails{std::move(details)}
+    , m_publishedFilmDetails{m_filmDetails}
+    , m_timeSource{std::move(timeSource)}
+{
+    m_startTime = m_timeSource->now();
+}
+
 FilmController::State FilmController::state() const
 {
     return m_state;
 }
 
-FilmDetails FilmController::filmDetails() const
+const FilmDetails &FilmController::filmDetails() const
+{
+    return *m_filmDetails;
+}
+
+std::shared_ptr<const FilmDetails> FilmController::filmDetailsSnapshot() const
 {
     return m_filmDetails;
 }
 
+void FilmController::publishFilmDetails(std::shared_ptr<const FilmDetails> details)
+{
+    const auto lock = std::scoped_lock{m_publishedMutex};
+    m_publishedFilmDetails = std::move(details);
+}
+
 std::chrono::milliseconds FilmController::currentTime() const
 {
     return m_currentTime;
@@ -39,26 +60,105 @@ bool FilmController::loading() const
 
 bool FilmController::atEnd() const
 {
-    return m_currentTime == m_filmDetails.duration;
+    return m_currentTime == m_filmDetails->duration;
+}
+
+bool FilmController::seekable() const
+{
+    return !loading() || m_bufferingEnabled;
+}
+
+bool FilmController::bufferingEnabled() const
+{
+    return m_bufferingEnabled;
+}
+
+void FilmController::setBufferingEnabled(bool enabled)
+{
+    m_bufferingEnabled = enabled;
+    updateBuffering();
+}
+
+const IntervalSet &FilmController::bufferedRanges() const
+{
+    return m_bufferedRanges;
+}
+
+void FilmController::addBufferedRange(std::chrono::milliseconds start, std::chrono::milliseconds end)
+{
+    const auto batch = this->batch();
+    m_bufferedRanges.insert(start, end);
+    notify(Notification::BufferedRangesChanged);
+    updateBuffering();
+}
+
+std::chrono::milliseconds FilmController::bufferedAhead() const
+{
+    if (!m_bufferingEnabled) {
+        return m_filmDetails->duration - m_currentTime;
+    }
+    const auto range = m_bufferedRanges.intervalAt(m_currentTime);
+    return range ? range->end - m_currentTime : std::chrono::milliseconds{};
+}
+
+const FilmController::BufferingSettings &FilmController::bufferingSettings() const
+{
+    return m_bufferingSettings;
+}
+
+void FilmController::setBufferingSettings(const BufferingSettings &settings)
+{
+    m_bufferingSettings = settings;
+    updateBuffering();
+}
+
+SegmentSource *FilmController::segmentSource() const
+{
+    return m_segmentSource;
+}
+
+void FilmController::setSegmentSource(SegmentSource *source)
+{
+    m_segmentSource = source;
+    m_segmentRequested = false;
+    pullSegments();
+}
+
+FilmController::BufferingStats FilmController::bufferingStats() const
+{
+    auto stats = m_bufferingStats;
+    if (m_stallStart) {
+        stats.stallDuration += m_timeSource->now() - *m_stallStart;
+    }
+    return stats;
 }
 
 void FilmController::play()
 {
+    if (loading() && m_bufferingEnabled) {
+        m_resumeState = State::Playing;
+        return;
+    }
     if (playing()) {
         return;
     }
     m_state = State::Playing;
-    m_clock.restart();
-    notify(m_stateChangedCallbacks);
+    m_lastUpdate = m_timeSource->now();
+    m_pendingTime = {};
+    notify(Notification::StateChanged);
 }
 
 void FilmController::pause()
 {
+    if (loading() && m_bufferingEnabled) {
+        m_resumeState = State::Paused;
+        return;
+    }
     if (paused()) {
         return;
     }
     m_state = State::Paused;
-    notify(m_stateChangedCallbacks);
+    notify(Notification::StateChanged);
 }
 
 void FilmController::restart()
@@ -77,45 +177,273 @@ void FilmController::jumpForward()
     jump(JumpInterval);
 }
 
-void FilmController::jumpTo(std::chrono::milliseconds time)
+std::chrono::milliseconds FilmController::backwardJumpTarget(std::chrono::milliseconds from) const
+{
+    return std::clamp(from - JumpInterval, std::chrono::milliseconds{0}, m_filmDetails->duration);
+}
+
+std::chrono::milliseconds FilmController::forwardJumpTarget(std::chrono::milliseconds from) const
+{
+    return std::clamp(from + JumpInterval, std::chrono::milliseconds{0}, m_filmDetails->duration);
+}
+
+void FilmController::jumpTo(std::chrono::milliseconds time, SeekMode mode)
 {
+    if (mode == SeekMode::Fast) {
+        time = m_filmDetails->keyframes.nearest(time).value_or(time);
+    }
     jump(time - m_currentTime);
 }
 
 void FilmController::update()
 {
+    applyPublishedFilmDetails();
+    pullSegments();
     if (playing()) {
-        m_currentTime += std::chrono::milliseconds{m_clock.getElapsedTime().asMilliseconds()};
-        if (m_currentTime > m_filmDetails.duration) {
-            m_currentTime = m_filmDetails.duration;
+        const auto now = m_timeSource->now();
+        m_pendingTime += now - m_lastUpdate;
+        m_lastUpdate = now;
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(m_pendingTime);
+        if (elapsed.count() == 0) {
+            return;
+        }
+        m_pendingTime -= elapsed;
+        if (const auto range = m_bufferingEnabled ? m_bufferedRanges.intervalAt(m_currentTime) : std::nullopt) {
+            m_currentTime = std::min(m_currentTime + elapsed, range->end);
+        } else {
+            m_currentTime += elapsed;
+        }
+        if (m_currentTime > m_filmDetails->duration) {
+            m_currentTime = m_filmDetails->duration;
             pause();
         }
-        m_clock.restart();
-        notify(m_currentTimeChangedCallbacks);
+        notify(Notification::CurrentTimeChanged);
+        updateBuffering();
     }
 }
 
-void FilmController::onCurrentTimeChanged(Callback &&callback)
+Connection FilmController::onCurrentTimeChanged(Callback &&callback)
+{
+    return m_currentTimeChanged.connect(std::move(callback));
+}
+
+Connection FilmController::onFilmDetailsChanged(Callback &&callback)
+{
+    return m_filmDetailsChanged.connect(std::move(callback));
+}
+
+Connection FilmController::onBufferedRangesChanged(Callback &&callback)
+{
+    return m_bufferedRangesChanged.connect(std::move(callback));
+}
+
+Connection FilmController::onCurrentTimeChanged(std::chrono::milliseconds step, Callback &&callback)
+{
+    return onCurrentTimeChanged([step](auto time) { return time / step; }, std::move(callback));
+}
+
+Connection FilmController::onCurrentTimeChanged(Quantizer &&quantizer, Callback &&callback)
 {
-    m_currentTimeChangedCallbacks.push_back(std::move(callback));
+    const auto bucket = quantizer(m_currentTime);
+    return m_quantizedCurrentTimeChanged.connect(
+        QuantizedCallback{.quantizer = std::move(quantizer), .callback = std::move(callback), .bucket = bucket});
 }
 
-void FilmController::onStateChanged(Callback &&callback)
+Connection FilmController::onStateChanged(Callback &&callback)
 {
-    m_stateChangedCallbacks.push_back(std::move(callback));
+    return m_stateChanged.connect(std::move(callback));
+}
+
+FilmController::Batch FilmController::batch()
+{
+    return Batch{*this};
+}
+
+const FilmController::NotificationStats &FilmController::notificationStats() const
+{
+    return m_notificationStats;
+}
+
+void FilmController::resetNotificationStats()
+{
+    m_notificationStats = {};
 }
 
 void FilmController::jump(std::chrono::milliseconds interval)
 {
-    if (loading()) {
+    if (!seekable()) {
         return;
     }
-    m_currentTime = std::clamp(m_currentTime + interval, std::chrono::milliseconds{0}, m_filmDetails.duration);
+    const auto batch = this->batch();
+    m_currentTime = std::clamp(m_currentTime + interval, std::chrono::milliseconds{0}, m_filmDetails->duration);
     update();
-    notify(m_currentTimeChangedCallbacks);
+    notify(Notification::CurrentTimeChanged);
+    updateBuffering();
+}
+
+void FilmController::applyPublishedFilmDetails()
+{
+    auto published = [this] {
+        const auto lock = std::scoped_lock{m_publishedMutex};
+        return m_publishedFilmDetails;
+    }();
+    if (published == m_filmDetails) {
+        return;
+    }
+    const auto batch = this->batch();
+    m_filmDetails = std::move(published);
+    notify(Notification::FilmDetailsChanged);
+    if (m_currentTime > m_filmDetails->duration) {
+        m_currentTime = m_filmDetails->duration;
+        notify(Notification::CurrentTimeChanged);
+    }
+    if (!m_bufferedRanges.empty()) {
+        m_bufferedRanges.clear();
+        notify(Notification::BufferedRangesChanged);
+    }
+    if (m_segmentSource) {
+        m_segmentSource->cancel();
+        m_segmentRequested = false;
+    }
+    updateBuffering();
+}
+
+// Keeps one segment in flight, starting at the first unbuffered time at or after the current time.
+void FilmController::pullSegments()
+{
+    if (!m_segmentSource || !m_bufferingEnabled) {
+        return;
+    }
+    const auto batch = this->batch();
+    while (const auto segment = m_segmentSource->poll()) {
+        m_segmentRequested = false;
+        addBufferedRange(segment->start, segment->end);
+    }
+    const auto start = m_currentTime + bufferedAhead();
+    if (m_segmentRequested || start >= m_filmDetails->duration
+        || start - m_currentTime >= m_bufferingSettings.readAhead) {
+        return;
+    }
+    m_segmentSource->request(
+        {.start = start, .end = std::min(start + m_bufferingSettings.segmentDuration, m_filmDetails->duration)});
+    m_segmentRequested = true;
+}
+
+// Enters Loading when nothing is buffered at the current time, or when playback has drained the buffer below the
+// low watermark, and leaves it once the high watermark or the end of the film is buffered.
+void FilmController::updateBuffering()
+{
+    if (!m_bufferingEnabled) {
+        return;
+    }
+    const auto ahead = bufferedAhead();
+    const auto bufferedToEnd = m_currentTime + ahead >= m_filmDetails->duration;
+    const auto highWatermark = std::max(m_bufferingSettings.highWatermark, m_bufferingSettings.lowWatermark);
+    if (loading() && (bufferedToEnd || (ahead.count() > 0 && ahead >= highWatermark))) {
+        leaveLoading();
+    } else if (
+        !loading() && !bufferedToEnd
+        && (ahead.count() == 0 || (playing() && ahead < m_bufferingSettings.lowWatermark))) {
+        enterLoading();
+    }
+}
+
+void FilmController::enterLoading()
+{
+    if (playing()) {
+        ++m_bufferingStats.stallCount;
+        m_stallStart = m_timeSource->now();
+    }
+    m_resumeState = m_state;
+    m_state = State::Loading;
+    notify(Notification::StateChanged);
+}
+
+void FilmController::leaveLoading()
+{
+    const auto now = m_timeSource->now();
+    if (m_stallStart) {
+        m_bufferingStats.stallDuration += now - *std::exchange(m_stallStart, std::nullopt);
+    }
+    if (!m_bufferingStats.startupLatency) {
+        m_bufferingStats.startupLatency = now - m_startTime;
+    }
+    m_state = m_resumeState;
+    m_lastUpdate = now;
+    m_pendingTime = {};
+    notify(Notification::StateChanged);
+}
+
+void FilmController::notify(Notification notification)
+{
+    ++m_notificationStats.raised;
+    if (m_batchDepth == 0) {
+        deliver(notification);
+    } else if (notification == Notification::CurrentTimeChanged) {
+        m_currentTimeChangedPending = true;
+    } else if (notification == Notification::StateChanged) {
+        m_stateChangedPending = true;
+    } else if (notification == Notification::FilmDetailsChanged) {
+        m_filmDetailsChangedPending = true;
+    } else {
+        m_bufferedRangesChangedPending = true;
+    }
+}
+
+void FilmController::deliver(Notification notification)
+{
+    ++m_notificationStats.delivered;
+    if (notification == Notification::CurrentTimeChanged) {
+        m_currentTimeChanged.emit();
+        m_quantizedCurrentTimeChanged.emit(m_currentTime);
+    } else if (notification == Notification::StateChanged) {
+        m_stateChanged.emit();
+    } else if (notification == Notification::FilmDetailsChanged) {
+        m_filmDetailsChanged.emit();
+    } else {
+        m_bufferedRangesChanged.emit();
+    }
+}
+
+void FilmController::beginBatch()
+{
+    ++m_batchDepth;
+}
+
+void FilmController::endBatch()
+{
+    if (--m_batchDepth > 0) {
+        return;
+    }
+    if (std::exchange(m_filmDetailsChangedPending, false)) {
+        deliver(Notification::FilmDetailsChanged);
+    }
+    if (std::exchange(m_bufferedRangesChangedPending, false)) {
+        deliver(Notification::BufferedRangesChanged);
+    }
+    if (std::exchange(m_stateChangedPending, false)) {
+        deliver(Notification::StateChanged);
+    }
+    if (std::exchange(m_currentTimeChangedPending, false)) {
+        deliver(Notification::CurrentTimeChanged);
+    }
+}
+
+void FilmController::QuantizedCallback::operator()(std::chrono::milliseconds time)
+{
+    if (const auto newBucket = quantizer(time); newBucket != bucket) {
+        bucket = newBucket;
+        callback();
+    }
+}
+
+FilmController::Batch::Batch(FilmController &controller)
+    : m_controller{controller}
+{
+    m_controller.beginBatch();
 }
 
-void FilmController::notify(const std::list<Callback> &callbacks)
+FilmController::Batch::~Batch()
 {
-    std::for_each(std::cbegin(callbacks), std::cend(callbacks), [](auto &c) { c(); });
+    m_controller.endBatch();
 }
\ No newline at end of file
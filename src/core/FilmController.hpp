@@ -1,48 +1,164 @@
 #pragma once
 
 #include "FilmDetails.hpp"
-#include <SFML/System/Clock.hpp>
+#include "IntervalSet.hpp"
+#include "SeekMode.hpp"
+#include "SegmentSource.hpp"
+#include "Signal.hpp"
+#include "TimeSource.hpp"
 #include <chrono>
-#include <functional>
-#include <list>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
 
 class FilmController
 {
 public:
-    using Callback = std::function<void()>;
+    using Callback = Signal<void()>::Slot;
+    using Quantizer = SmallFunction<std::int64_t(std::chrono::milliseconds)>;
 
-    explicit FilmController(const FilmDetails &details);
+    explicit FilmController(
+        const FilmDetails &details, std::shared_ptr<TimeSource> timeSource = std::make_shared<SteadyTimeSource>());
+    // Takes a snapshot as it is, so one built with FilmDetails::allocateShared or makeShared is not copied again.
+    explicit FilmController(
+        std::shared_ptr<const FilmDetails> details,
+        std::shared_ptr<TimeSource> timeSource = std::make_shared<SteadyTimeSource>());
 
     enum class State { Playing, Paused, Loading };
 
+    struct NotificationStats
+    {
+        std::size_t raised{};
+        std::size_t delivered{};
+    };
+
+    // Playback stalls when less than lowWatermark is buffered ahead of it and resumes once highWatermark is.
+    // Segments of segmentDuration are pulled from the segment source up to readAhead past the current time.
+    struct BufferingSettings
+    {
+        std::chrono::milliseconds lowWatermark{};
+        std::chrono::milliseconds highWatermark{};
+        std::chrono::milliseconds segmentDuration{std::chrono::seconds{5}};
+        std::chrono::milliseconds readAhead{std::chrono::seconds{30}};
+    };
+
+    // A stall is a spell in Loading that interrupted playback, including one caused by seeking to unbuffered time.
+    struct BufferingStats
+    {
+        std::size_t stallCount{};
+        std::chrono::nanoseconds stallDuration{};
+        std::optional<std::chrono::nanoseconds> startupLatency;
+    };
+
+    class Batch
+    {
+    public:
+        explicit Batch(FilmController &controller);
+        Batch(const Batch &) = delete;
+        Batch &operator=(const Batch &) = delete;
+        ~Batch();
+
+    private:
+        FilmController &m_controller;
+    };
+
     State state() const;
-    FilmDetails filmDetails() const;
+    const FilmDetails &filmDetails() const;
+    std::shared_ptr<const FilmDetails> filmDetailsSnapshot() const;
+    void publishFilmDetails(std::shared_ptr<const FilmDetails> details);
     std::chrono::milliseconds currentTime() const;
 
     bool playing() const;
     bool paused() const;
     bool loading() const;
     bool atEnd() const;
+    bool seekable() const;
+
+    bool bufferingEnabled() const;
+    void setBufferingEnabled(bool enabled);
+    const IntervalSet &bufferedRanges() const;
+    void addBufferedRange(std::chrono::milliseconds start, std::chrono::milliseconds end);
+    std::chrono::milliseconds bufferedAhead() const;
+    const BufferingSettings &bufferingSettings() const;
+    void setBufferingSettings(const BufferingSettings &settings);
+    SegmentSource *segmentSource() const;
+    void setSegmentSource(SegmentSource *source);
+    BufferingStats bufferingStats() const;
 
     void play();
     void pause();
     void restart();
     void jumpBackward();
     void jumpForward();
-    void jumpTo(std::chrono::milliseconds time);
+    void jumpTo(std::chrono::milliseconds time, SeekMode mode = SeekMode::Exact);
+    // Where jumpBackward()/jumpForward() would land when starting from the given time, for callers that route
+    // jumps through a SeekScheduler.
+    std::chrono::milliseconds backwardJumpTarget(std::chrono::milliseconds from) const;
+    std::chrono::milliseconds forwardJumpTarget(std::chrono::milliseconds from) const;
     void update();
 
-    void onCurrentTimeChanged(Callback &&callback);
-    void onStateChanged(Callback &&callback);
+    Batch batch();
+    const NotificationStats &notificationStats() const;
+    void resetNotificationStats();
+
+    Connection onCurrentTimeChanged(Callback &&callback);
+    Connection onCurrentTimeChanged(std::chrono::milliseconds step, Callback &&callback);
+    Connection onCurrentTimeChanged(Quantizer &&quantizer, Callback &&callback);
+    Connection onStateChanged(Callback &&callback);
+    Connection onFilmDetailsChanged(Callback &&callback);
+    Connection onBufferedRangesChanged(Callback &&callback);
 
 private:
+    enum class Notification { CurrentTimeChanged, StateChanged, FilmDetailsChanged, BufferedRangesChanged };
+
+    struct QuantizedCallback
+    {
+        void operator()(std::chrono::milliseconds time);
+
+        Quantizer quantizer;
+        Callback callback;
+        std::int64_t bucket{};
+    };
+
     void jump(std::chrono::milliseconds interval);
-    void notify(const std::list<Callback> &callbacks);
+    void applyPublishedFilmDetails();
+    void pullSegments();
+    void updateBuffering();
+    void enterLoading();
+    void leaveLoading();
+    void notify(Notification notification);
+    void deliver(Notification notification);
+    void beginBatch();
+    void endBatch();
 
-    FilmDetails m_filmDetails;
+    std::shared_ptr<const FilmDetails> m_filmDetails;
+    // std::atomic<std::shared_ptr> is not available in libc++, so publishing goes through a mutex.
+    std::mutex m_publishedMutex;
+    std::shared_ptr<const FilmDetails> m_publishedFilmDetails;
     State m_state{State::Loading};
+    State m_resumeState{State::Paused};
+    bool m_bufferingEnabled{};
+    IntervalSet m_bufferedRanges;
+    BufferingSettings m_bufferingSettings;
+    SegmentSource *m_segmentSource{};
+    bool m_segmentRequested{};
+    BufferingStats m_bufferingStats;
+    std::optional<std::chrono::nanoseconds> m_stallStart;
+    std::chrono::nanoseconds m_startTime{};
     std::chrono::milliseconds m_currentTime{};
-    std::list<Callback> m_currentTimeChangedCallbacks;
-    std::list<Callback> m_stateChangedCallbacks;
-    sf::Clock m_clock;
+    std::chrono::nanoseconds m_pendingTime{};
+    std::chrono::nanoseconds m_lastUpdate{};
+    Signal<void()> m_currentTimeChanged;
+    Signal<void()> m_stateChanged;
+    Signal<void()> m_filmDetailsChanged;
+    Signal<void()> m_bufferedRangesChanged;
+    Signal<void(std::chrono::milliseconds), sizeof(QuantizedCallback)> m_quantizedCurrentTimeChanged;
+    int m_batchDepth{};
+    bool m_currentTimeChangedPending{};
+    bool m_stateChangedPending{};
+    bool m_filmDetailsChangedPending{};
+    bool m_bufferedRangesChangedPending{};
+    NotificationStats m_notificationStats;
+    std::shared_ptr<TimeSource> m_timeSource;
 };
@@ -0,0 +1,46 @@
+#include "FilmDetails.hpp"
+#include "Arena.hpp"
+
+namespace {
+struct ArenaFilmDetails
+{
+    explicit ArenaFilmDetails(std::size_t initialSize)
+        : arena{initialSize}
+    {}
+
+    Arena arena;
+    FilmDetails details{
+        .name = std::pmr::string{arena.resource()},
+        .duration = {},
+        .chapters = std::pmr::vector<FilmDetails::ChapterDetails>{arena.resource()},
+        .keyframes = KeyframeIndex{arena.resource()}};
+};
+} // namespace
+
+std::shared_ptr<FilmDetails> FilmDetails::allocateShared(std::size_t initialSize)
+{
+    auto storage = std::make_shared<ArenaFilmDetails>(initialSize);
+    return {storage, &storage->details};
+}
+
+std::shared_ptr<const FilmDetails> FilmDetails::makeShared(const FilmDetails &details)
+{
+    auto initialSize = sizeof(ChapterDetails) * details.chapters.size() + details.name.size() + 1
+                       + details.keyframes.memoryUsage();
+    for (const auto &chapter : details.chapters) {
+        initialSize += chapter.name.size() + 1;
+    }
+    auto copy = allocateShared(initialSize);
+    auto *const resource = copy->chapters.get_allocator().resource();
+    copy->name = details.name;
+    copy->duration = details.duration;
+    copy->keyframes = details.keyframes;
+    copy->chapters.reserve(details.chapters.size());
+    for (const auto &chapter : details.chapters) {
+        copy->chapters.push_back(
+            {.name = std::pmr::string{chapter.name, resource},
+             .startTime = chapter.startTime,
+             .endTime = chapter.endTime});
+    }
+    return copy;
+}
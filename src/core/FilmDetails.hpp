@@ -1,6 +1,9 @@
 #pragma once
 
+#include "KeyframeIndex.hpp"
 #include <chrono>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -8,14 +11,20 @@ struct FilmDetails
 {
     struct ChapterDetails
     {
-        std::string name;
+        std::pmr::string name;
         std::chrono::milliseconds startTime{};
         std::chrono::milliseconds endTime{};
 
-        std::chrono::milliseconds duration() { return endTime - startTime; }
+        std::chrono::milliseconds duration() const { return endTime - startTime; }
     };
 
-    std::string name;
+    std::pmr::string name;
     std::chrono::milliseconds duration{};
-    std::vector<ChapterDetails> chapters;
+    std::pmr::vector<ChapterDetails> chapters;
+    KeyframeIndex keyframes;
+
+    // Empty details whose strings and vectors allocate from an arena owned by the returned pointer, so they can be
+    // filled in place instead of being built elsewhere and copied by makeShared.
+    static std::shared_ptr<FilmDetails> allocateShared(std::size_t initialSize);
+    static std::shared_ptr<const FilmDetails> makeShared(const FilmDetails &details);
 };
@@ -0,0 +1,57 @@
+#include "IntervalSet.hpp"
+#include <algorithm>
+
+void IntervalSet::insert(std::chrono::milliseconds start, std::chrono::milliseconds end)
+{
+    if (end <= start) {
+        return;
+    }
+    auto first = m_intervals.upper_bound(start);
+    if (first != std::cbegin(m_intervals) && std::prev(first)->second >= start) {
+        --first;
+    }
+    auto last = first;
+    for (; last != std::cend(m_intervals) && last->first <= end; ++last) {
+        start = std::min(start, last->first);
+        end = std::max(end, last->second);
+        m_total -= last->second - last->first;
+    }
+    const auto hint = m_intervals.erase(first, last);
+    m_intervals.emplace_hint(hint, start, end);
+    m_total += end - start;
+}
+
+void IntervalSet::clear()
+{
+    m_intervals.clear();
+    m_total = {};
+}
+
+std::size_t IntervalSet::size() const
+{
+    return m_intervals.size();
+}
+
+bool IntervalSet::empty() const
+{
+    return m_intervals.empty();
+}
+
+bool IntervalSet::contains(std::chrono::milliseconds time) const
+{
+    return intervalAt(time).has_value();
+}
+
+std::optional<IntervalSet::Interval> IntervalSet::intervalAt(std::chrono::milliseconds time) const
+{
+    const auto it = m_intervals.upper_bound(time);
+    if (it == std::cbegin(m_intervals) || std::prev(it)->second <= time) {
+        return std::nullopt;
+    }
+    return Interval{.start = std::prev(it)->first, .end = std::prev(it)->second};
+}
+
+std::chrono::milliseconds IntervalSet::total() const
+{
+    return m_total;
+}
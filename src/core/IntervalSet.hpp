@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <optional>
+
+// Disjoint half-open time intervals. Inserting merges overlapping and touching intervals, so lookups and
+// insertions stay logarithmic in the number of gaps.
+class IntervalSet
+{
+public:
+    struct Interval
+    {
+        std::chrono::milliseconds start{};
+        std::chrono::milliseconds end{};
+
+        bool operator==(const Interval &) const = default;
+    };
+
+    void insert(std::chrono::milliseconds start, std::chrono::milliseconds end);
+    void clear();
+
+    std::size_t size() const;
+    bool empty() const;
+    bool contains(std::chrono::milliseconds time) const;
+    std::optional<Interval> intervalAt(std::chrono::milliseconds time) const;
+    std::chrono::milliseconds total() const;
+
+    // Calls callback with every interval that overlaps [from, to), in order.
+    template<typename Callback>
+    void forEachOverlapping(std::chrono::milliseconds from, std::chrono::milliseconds to, Callback &&callback) const
+    {
+        auto it = m_intervals.upper_bound(from);
+        if (it != std::cbegin(m_intervals) && std::prev(it)->second > from) {
+            --it;
+        }
+        for (; it != std::cend(m_intervals) && it->first < to; ++it) {
+            callback(Interval{.start = it->first, .end = it->second});
+        }
+    }
+
+private:
+    std::map<std::chrono::milliseconds, std::chrono::milliseconds> m_intervals;
+    std::chrono::milliseconds m_total{};
+};
@@ -0,0 +1,117 @@
+#include "KeyframeIndex.hpp"
+#include <algorithm>
+#include <limits>
+
+constexpr auto BlockSize = std::size_t{128};
+constexpr auto MaximumDelta = std::chrono::milliseconds{std::numeric_limits<std::uint32_t>::max()};
+
+KeyframeIndex::KeyframeIndex(const allocator_type &allocator)
+    : m_blockBases{allocator}
+    , m_blockOffsets{allocator}
+    , m_deltas{allocator}
+{}
+
+KeyframeIndex::KeyframeIndex(std::vector<std::chrono::milliseconds> keyframes, const allocator_type &allocator)
+    : KeyframeIndex{allocator}
+{
+    std::ranges::sort(keyframes);
+    const auto [last, end] = std::ranges::unique(keyframes);
+    keyframes.erase(last, end);
+
+    m_deltas.reserve(keyframes.size());
+    m_blockBases.reserve(keyframes.size() / BlockSize + 1);
+    m_blockOffsets.reserve(keyframes.size() / BlockSize + 1);
+    for (const auto keyframe : keyframes) {
+        if (m_blockBases.empty() || m_deltas.size() - m_blockOffsets.back() == BlockSize
+            || keyframe - m_blockBases.back() > MaximumDelta) {
+            m_blockBases.push_back(keyframe);
+            m_blockOffsets.push_back(std::uint32_t(m_deltas.size()));
+        }
+        m_deltas.push_back(std::uint32_t((keyframe - m_blockBases.back()).count()));
+    }
+}
+
+KeyframeIndex KeyframeIndex::uniform(
+    std::chrono::milliseconds interval, std::chrono::milliseconds duration, const allocator_type &allocator)
+{
+    auto keyframes = std::vector<std::chrono::milliseconds>{};
+    if (interval.count() > 0) {
+        keyframes.reserve(std::size_t(duration / interval) + 1);
+        for (auto time = std::chrono::milliseconds{0}; time <= duration; time += interval) {
+            keyframes.push_back(time);
+        }
+    }
+    return KeyframeIndex{std::move(keyframes), allocator};
+}
+
+KeyframeIndex::allocator_type KeyframeIndex::get_allocator() const
+{
+    return m_deltas.get_allocator();
+}
+
+std::size_t KeyframeIndex::size() const
+{
+    return m_deltas.size();
+}
+
+bool KeyframeIndex::empty() const
+{
+    return m_deltas.empty();
+}
+
+std::chrono::milliseconds KeyframeIndex::at(std::size_t index) const
+{
+    const auto block = std::size_t(std::ranges::upper_bound(m_blockOffsets, index) - std::cbegin(m_blockOffsets) - 1);
+    return m_blockBases[block] + std::chrono::milliseconds{m_deltas[index]};
+}
+
+std::size_t KeyframeIndex::memoryUsage() const
+{
+    return m_blockBases.capacity() * sizeof(std::chrono::milliseconds)
+           + (m_blockOffsets.capacity() + m_deltas.capacity()) * sizeof(std::uint32_t);
+}
+
+std::optional<std::chrono::milliseconds> KeyframeIndex::atOrBefore(std::chrono::milliseconds time) const
+{
+    if (empty() || time < m_blockBases.front()) {
+        return std::nullopt;
+    }
+    const auto block = blockOf(time);
+    const auto delta = std::uint32_t(std::min(time - m_blockBases[block], MaximumDelta).count());
+    const auto first = std::cbegin(m_deltas) + m_blockOffsets[block];
+    const auto after = std::upper_bound(first, std::cbegin(m_deltas) + std::ptrdiff_t(blockEnd(block)), delta);
+    return m_blockBases[block] + std::chrono::milliseconds{*(after - 1)};
+}
+
+std::optional<std::chrono::milliseconds> KeyframeIndex::nearest(std::chrono::milliseconds time) const
+{
+    if (empty()) {
+        return std::nullopt;
+    }
+    if (time <= m_blockBases.front()) {
+        return m_blockBases.front();
+    }
+    const auto block = blockOf(time);
+    const auto delta = std::uint32_t(std::min(time - m_blockBases[block], MaximumDelta).count());
+    const auto first = std::cbegin(m_deltas) + m_blockOffsets[block];
+    const auto last = std::cbegin(m_deltas) + std::ptrdiff_t(blockEnd(block));
+    const auto after = std::upper_bound(first, last, delta);
+    const auto before = m_blockBases[block] + std::chrono::milliseconds{*(after - 1)};
+    auto next = std::optional<std::chrono::milliseconds>{};
+    if (after != last) {
+        next = m_blockBases[block] + std::chrono::milliseconds{*after};
+    } else if (block + 1 < m_blockBases.size()) {
+        next = m_blockBases[block + 1];
+    }
+    return next && *next - time < time - before ? *next : before;
+}
+
+std::size_t KeyframeIndex::blockOf(std::chrono::milliseconds time) const
+{
+    return std::size_t(std::ranges::upper_bound(m_blockBases, time) - std::cbegin(m_blockBases) - 1);
+}
+
+std::size_t KeyframeIndex::blockEnd(std::size_t block) const
+{
+    return block + 1 < m_blockOffsets.size() ? m_blockOffsets[block + 1] : m_deltas.size();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+// Sorted keyframe times stored as 32-bit offsets from the first keyframe of their block, so a keyframe costs about
+// four bytes. Lookups binary-search the block bases, then the offsets inside one block. The arrays come from the
+// given allocator, so an index copied into a film's arena is released with it; copy assignment keeps the
+// destination's allocator.
+class KeyframeIndex
+{
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    KeyframeIndex() = default;
+    explicit KeyframeIndex(const allocator_type &allocator);
+    explicit KeyframeIndex(std::vector<std::chrono::milliseconds> keyframes, const allocator_type &allocator = {});
+
+    static KeyframeIndex uniform(
+        std::chrono::milliseconds interval, std::chrono::milliseconds duration, const allocator_type &allocator = {});
+
+    allocator_type get_allocator() const;
+
+    std::size_t size() const;
+    bool empty() const;
+    std::chrono::milliseconds at(std::size_t index) const;
+    std::size_t memoryUsage() const;
+
+    std::optional<std::chrono::milliseconds> atOrBefore(std::chrono::milliseconds time) const;
+    std::optional<std::chrono::milliseconds> nearest(std::chrono::milliseconds time) const;
+
+private:
+    std::size_t blockOf(std::chrono::milliseconds time) const;
+    std::size_t blockEnd(std::size_t block) const;
+
+    std::pmr::vector<std::chrono::milliseconds> m_blockBases;
+    std::pmr::vector<std::uint32_t> m_blockOffsets;
+    std::pmr::vector<std::uint32_t> m_deltas;
+};
@@ -0,0 +1,94 @@
+#include "MappedFile.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::expected<MappedFile, std::error_code> MappedFile::open(const std::filesystem::path &path)
+{
+    auto file = MappedFile{};
+#ifdef _WIN32
+    auto stream = std::ifstream{path, std::ios::binary};
+    if (!stream) {
+        return std::unexpected{std::make_error_code(std::errc::no_such_file_or_directory)};
+    }
+    file.m_buffer.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+    file.m_data = file.m_buffer.data();
+    file.m_size = file.m_buffer.size();
+#else
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return std::unexpected{std::error_code{errno, std::generic_category()}};
+    }
+    struct stat status
+    {};
+    if (::fstat(descriptor, &status) < 0) {
+        const auto error = std::error_code{errno, std::generic_category()};
+        ::close(descriptor);
+        return std::unexpected{error};
+    }
+    if (status.st_size > 0) {
+        auto *const data = ::mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (data == MAP_FAILED) {
+            const auto error = std::error_code{errno, std::generic_category()};
+            ::close(descriptor);
+            return std::unexpected{error};
+        }
+        ::madvise(data, std::size_t(status.st_size), MADV_SEQUENTIAL);
+        file.m_data = static_cast<const char *>(data);
+        file.m_size = std::size_t(status.st_size);
+    }
+    ::close(descriptor);
+#endif
+    return file;
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other) {
+        unmap();
+#ifdef _WIN32
+        m_buffer = std::move(other.m_buffer);
+        m_data = m_buffer.data();
+#else
+        m_data = other.m_data;
+#endif
+        m_size = std::exchange(other.m_size, 0);
+        other.m_data = nullptr;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+std::string_view MappedFile::contents() const
+{
+    return {m_data, m_size};
+}
+
+void MappedFile::unmap()
+{
+#ifndef _WIN32
+    if (m_data) {
+        ::munmap(const_cast<char *>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+class MappedFile
+{
+public:
+    static std::expected<MappedFile, std::error_code> open(const std::filesystem::path &path);
+
+    MappedFile() = default;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    ~MappedFile();
+
+    std::string_view contents() const;
+
+private:
+    void unmap();
+
+    const char *m_data{};
+    std::size_t m_size{};
+#ifdef _WIN32
+    std::vector<char> m_buffer;
+#endif
+};
@@ -0,0 +1,22 @@
+#include "Scheduler.hpp"
+#include <algorithm>
+
+std::optional<Scheduler::Clock::time_point> Scheduler::nextWakeUp() const
+{
+    return m_nextWakeUp;
+}
+
+void Scheduler::wakeUpAt(Clock::time_point time)
+{
+    m_nextWakeUp = m_nextWakeUp ? std::min(*m_nextWakeUp, time) : time;
+}
+
+void Scheduler::wakeUpIn(Clock::duration delay)
+{
+    wakeUpAt(Clock::now() + delay);
+}
+
+void Scheduler::reset()
+{
+    m_nextWakeUp.reset();
+}
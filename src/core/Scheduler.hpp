@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+class Scheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    std::optional<Clock::time_point> nextWakeUp() const;
+
+    void wakeUpAt(Clock::time_point time);
+    void wakeUpIn(Clock::duration delay);
+    void reset();
+
+private:
+    std::optional<Clock::time_point> m_nextWakeUp;
+};
@@ -0,0 +1,56 @@
+#include "SeekBackend.hpp"
+#include <algorithm>
+
+SimulatedSeekBackend::SimulatedSeekBackend(std::chrono::nanoseconds latency, std::shared_ptr<TimeSource> timeSource)
+    : m_latency{latency}
+    , m_fastLatency{latency}
+    , m_timeSource{std::move(timeSource)}
+{}
+
+std::chrono::nanoseconds SimulatedSeekBackend::latency() const
+{
+    return m_latency;
+}
+
+void SimulatedSeekBackend::setLatency(std::chrono::nanoseconds latency)
+{
+    m_latency = latency;
+}
+
+std::chrono::nanoseconds SimulatedSeekBackend::fastLatency() const
+{
+    return m_fastLatency;
+}
+
+void SimulatedSeekBackend::setFastLatency(std::chrono::nanoseconds latency)
+{
+    m_fastLatency = latency;
+}
+
+std::size_t SimulatedSeekBackend::seekCount() const
+{
+    return m_seekCount;
+}
+
+std::size_t SimulatedSeekBackend::maximumInFlight() const
+{
+    return m_maximumInFlight;
+}
+
+void SimulatedSeekBackend::seek(SeekTarget target)
+{
+    const auto latency = target.mode == SeekMode::Fast ? m_fastLatency : m_latency;
+    m_inFlight.push_back({.target = target, .completion = m_timeSource->now() + latency});
+    ++m_seekCount;
+    m_maximumInFlight = std::max(m_maximumInFlight, m_inFlight.size());
+}
+
+std::optional<SeekTarget> SimulatedSeekBackend::poll()
+{
+    if (m_inFlight.empty() || m_inFlight.front().completion > m_timeSource->now()) {
+        return std::nullopt;
+    }
+    const auto target = m_inFlight.front().target;
+    m_inFlight.pop_front();
+    return target;
+}
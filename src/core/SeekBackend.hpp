@@ -0,0 +1,61 @@
+#pragma once
+
+#include "SeekMode.hpp"
+#include "TimeSource.hpp"
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+
+struct SeekTarget
+{
+    std::chrono::milliseconds time{};
+    SeekMode mode{};
+
+    bool operator==(const SeekTarget &) const = default;
+};
+
+// Something that performs seeks asynchronously, such as a decoder. poll() returns the target of the oldest seek
+// that has completed since the last call.
+class SeekBackend
+{
+public:
+    virtual ~SeekBackend() = default;
+
+    virtual void seek(SeekTarget target) = 0;
+    virtual std::optional<SeekTarget> poll() = 0;
+};
+
+// Completes seeks in order, each one latency after it was started, as a decoder with a queue would. Fast seeks
+// take fastLatency, which defaults to latency.
+class SimulatedSeekBackend : public SeekBackend
+{
+public:
+    explicit SimulatedSeekBackend(
+        std::chrono::nanoseconds latency = {},
+        std::shared_ptr<TimeSource> timeSource = std::make_shared<SteadyTimeSource>());
+
+    std::chrono::nanoseconds latency() const;
+    void setLatency(std::chrono::nanoseconds latency);
+    std::chrono::nanoseconds fastLatency() const;
+    void setFastLatency(std::chrono::nanoseconds latency);
+    std::size_t seekCount() const;
+    std::size_t maximumInFlight() const;
+
+    void seek(SeekTarget target) override;
+    std::optional<SeekTarget> poll() override;
+
+private:
+    struct Seek
+    {
+        SeekTarget target;
+        std::chrono::nanoseconds completion{};
+    };
+
+    std::chrono::nanoseconds m_latency;
+    std::chrono::nanoseconds m_fastLatency;
+    std::shared_ptr<TimeSource> m_timeSource;
+    std::deque<Seek> m_inFlight;
+    std::size_t m_seekCount{};
+    std::size_t m_maximumInFlight{};
+};
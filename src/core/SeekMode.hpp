@@ -0,0 +1,4 @@
+#pragma once
+
+// Fast seeks snap to the nearest keyframe, which a decoder can start from without decoding the frames before it.
+enum class SeekMode { Exact, Fast };
@@ -0,0 +1,111 @@
+#include "SeekScheduler.hpp"
+#include <algorithm>
+#include <utility>
+
+constexpr auto InFlightPollInterval = std::chrono::milliseconds{4};
+
+SeekScheduler::SeekScheduler(SeekBackend &backend, std::shared_ptr<TimeSource> timeSource)
+    : m_backend{backend}
+    , m_timeSource{std::move(timeSource)}
+{}
+
+std::chrono::nanoseconds SeekScheduler::minimumInterval() const
+{
+    return m_minimumInterval;
+}
+
+void SeekScheduler::setMinimumInterval(std::chrono::nanoseconds interval)
+{
+    m_minimumInterval = interval;
+}
+
+void SeekScheduler::request(std::chrono::milliseconds time, SeekMode mode)
+{
+    ++m_stats.requested;
+    const auto target = SeekTarget{.time = time, .mode = mode};
+    if (m_pending) {
+        m_pending->target = target;
+    } else {
+        m_pending = Seek{.target = target, .requested = m_timeSource->now()};
+    }
+    update();
+}
+
+void SeekScheduler::update()
+{
+    for (;;) {
+        if (m_inFlight) {
+            const auto completed = m_backend.poll();
+            if (!completed) {
+                return;
+            }
+            complete(*completed);
+        }
+        const auto now = m_timeSource->now();
+        if (!m_pending || !canIssue(now)) {
+            return;
+        }
+        issue(now);
+    }
+}
+
+bool SeekScheduler::busy() const
+{
+    return m_pending || m_inFlight;
+}
+
+std::optional<std::chrono::milliseconds> SeekScheduler::target() const
+{
+    if (m_pending) {
+        return m_pending->target.time;
+    }
+    if (m_inFlight) {
+        return m_inFlight->target.time;
+    }
+    return std::nullopt;
+}
+
+void SeekScheduler::scheduleWakeUp(Scheduler &scheduler) const
+{
+    if (m_inFlight) {
+        scheduler.wakeUpIn(InFlightPollInterval);
+    } else if (m_pending) {
+        const auto now = m_timeSource->now();
+        const auto delay = canIssue(now) ? std::chrono::nanoseconds{} : *m_lastIssue + m_minimumInterval - now;
+        scheduler.wakeUpIn(std::chrono::duration_cast<Scheduler::Clock::duration>(delay));
+    }
+}
+
+Connection SeekScheduler::onSeekCompleted(Callback &&callback)
+{
+    return m_seekCompleted.connect(std::move(callback));
+}
+
+const SeekScheduler::Stats &SeekScheduler::stats() const
+{
+    return m_stats;
+}
+
+bool SeekScheduler::canIssue(std::chrono::nanoseconds now) const
+{
+    return !m_inFlight && (!m_lastIssue || now - *m_lastIssue >= m_minimumInterval);
+}
+
+void SeekScheduler::issue(std::chrono::nanoseconds now)
+{
+    m_inFlight = std::exchange(m_pending, std::nullopt);
+    m_lastIssue = now;
+    ++m_stats.issued;
+    m_backend.seek(m_inFlight->target);
+}
+
+void SeekScheduler::complete(SeekTarget target)
+{
+    const auto latency = m_timeSource->now() - m_inFlight->requested;
+    m_inFlight.reset();
+    ++m_stats.completed;
+    m_stats.lastLatency = latency;
+    m_stats.maximumLatency = std::max(m_stats.maximumLatency, latency);
+    m_stats.totalLatency += latency;
+    m_seekCompleted.emit(target);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Scheduler.hpp"
+#include "SeekBackend.hpp"
+#include "Signal.hpp"
+
+// Sits between the UI and a SeekBackend. At most one seek is in flight; requests made meanwhile collapse into
+// the latest one, which is issued once the backend completes and the minimum interval since the last issued
+// seek has passed.
+class SeekScheduler
+{
+public:
+    using Callback = Signal<void(SeekTarget)>::Slot;
+
+    struct Stats
+    {
+        std::size_t requested{};
+        std::size_t issued{};
+        std::size_t completed{};
+        std::chrono::nanoseconds lastLatency{};
+        std::chrono::nanoseconds maximumLatency{};
+        std::chrono::nanoseconds totalLatency{};
+    };
+
+    explicit SeekScheduler(
+        SeekBackend &backend, std::shared_ptr<TimeSource> timeSource = std::make_shared<SteadyTimeSource>());
+
+    std::chrono::nanoseconds minimumInterval() const;
+    void setMinimumInterval(std::chrono::nanoseconds interval);
+
+    void request(std::chrono::milliseconds time, SeekMode mode = SeekMode::Exact);
+    void update();
+    bool busy() const;
+    std::optional<std::chrono::milliseconds> target() const;
+    void scheduleWakeUp(Scheduler &scheduler) const;
+
+    Connection onSeekCompleted(Callback &&callback);
+    const Stats &stats() const;
+
+private:
+    struct Seek
+    {
+        SeekTarget target;
+        std::chrono::nanoseconds requested{};
+    };
+
+    bool canIssue(std::chrono::nanoseconds now) const;
+    void issue(std::chrono::nanoseconds now);
+    void complete(SeekTarget target);
+
+    SeekBackend &m_backend;
+    std::shared_ptr<TimeSource> m_timeSource;
+    std::chrono::nanoseconds m_minimumInterval{};
+    std::optional<Seek> m_pending;
+    std::optional<Seek> m_inFlight;
+    std::optional<std::chrono::nanoseconds> m_lastIssue;
+    Signal<void(SeekTarget)> m_seekCompleted;
+    Stats m_stats;
+};
@@ -0,0 +1,57 @@
+#include "SegmentSource.hpp"
+#include <algorithm>
+
+SimulatedSegmentSource::SimulatedSegmentSource(Settings settings, std::shared_ptr<TimeSource> timeSource)
+    : m_settings{settings}
+    , m_timeSource{std::move(timeSource)}
+    , m_random{settings.seed}
+{}
+
+std::size_t SimulatedSegmentSource::requestCount() const
+{
+    return m_requestCount;
+}
+
+std::size_t SimulatedSegmentSource::deliveredSegments() const
+{
+    return m_deliveredSegments;
+}
+
+void SimulatedSegmentSource::request(Segment segment)
+{
+    const auto now = m_timeSource->now();
+    auto start = m_inFlight.empty() ? now : std::max(now, m_inFlight.back().completion);
+    if (m_requestCount++ == 0) {
+        start += m_settings.startupLatency;
+    }
+    auto jitter = std::uniform_int_distribution<std::int64_t>{0, m_settings.jitter.count()};
+    const auto download = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double, std::milli>{(segment.end - segment.start).count() / m_settings.bandwidth});
+    m_inFlight.push_back(
+        {.segment = segment,
+         .completion = start + m_settings.requestLatency + std::chrono::milliseconds{jitter(m_random)} + download});
+}
+
+std::optional<SegmentSource::Segment> SimulatedSegmentSource::poll()
+{
+    if (m_inFlight.empty() || m_inFlight.front().completion > m_timeSource->now()) {
+        return std::nullopt;
+    }
+    const auto segment = m_inFlight.front().segment;
+    m_inFlight.pop_front();
+    ++m_deliveredSegments;
+    return segment;
+}
+
+void SimulatedSegmentSource::cancel()
+{
+    m_inFlight.clear();
+}
+
+void SimulatedSegmentSource::scheduleWakeUp(Scheduler &scheduler) const
+{
+    if (!m_inFlight.empty()) {
+        scheduler.wakeUpIn(std::chrono::duration_cast<Scheduler::Clock::duration>(
+            std::max(m_inFlight.front().completion - m_timeSource->now(), std::chrono::nanoseconds{})));
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "IntervalSet.hpp"
+#include "Scheduler.hpp"
+#include "TimeSource.hpp"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <random>
+
+// Something that fetches media segments asynchronously, such as a network loader. poll() returns the oldest
+// requested segment that has arrived since the last call; cancel() drops every request that has not.
+class SegmentSource
+{
+public:
+    using Segment = IntervalSet::Interval;
+
+    virtual ~SegmentSource() = default;
+
+    virtual void request(Segment segment) = 0;
+    virtual std::optional<Segment> poll() = 0;
+    virtual void cancel() = 0;
+};
+
+// Delivers segments in order over a simulated connection: the first request waits startupLatency, every request
+// waits requestLatency plus up to jitter, and the segment itself downloads at bandwidth times playback speed.
+class SimulatedSegmentSource : public SegmentSource
+{
+public:
+    struct Settings
+    {
+        std::chrono::milliseconds startupLatency{};
+        std::chrono::milliseconds requestLatency{};
+        std::chrono::milliseconds jitter{};
+        double bandwidth{1.0};
+        std::uint64_t seed{};
+    };
+
+    explicit SimulatedSegmentSource(
+        Settings settings, std::shared_ptr<TimeSource> timeSource = std::make_shared<SteadyTimeSource>());
+
+    std::size_t requestCount() const;
+    std::size_t deliveredSegments() const;
+
+    void request(Segment segment) override;
+    std::optional<Segment> poll() override;
+    void cancel() override;
+    void scheduleWakeUp(Scheduler &scheduler) const;
+
+private:
+    struct Download
+    {
+        Segment segment;
+        std::chrono::nanoseconds completion{};
+    };
+
+    Settings m_settings;
+    std::shared_ptr<TimeSource> m_timeSource;
+    std::mt19937_64 m_random;
+    std::deque<Download> m_inFlight;
+    std::size_t m_requestCount{};
+    std::size_t m_deliveredSegments{};
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Connection.hpp"
+#include "SmallFunction.hpp"
+#include <algorithm>
+#include <vector>
+
+template<typename Signature, std::size_t Capacity = DefaultSmallFunctionCapacity>
+class Signal;
+
+template<typename... Args, std::size_t Capacity>
+class Signal<void(Args...), Capacity>
+{
+public:
+    using Slot = SmallFunction<void(Args...), Capacity>;
+
+    Signal()
+        : m_state{std::make_shared<State>()}
+    {}
+
+    Signal(const Signal &) = delete;
+    Signal &operator=(const Signal &) = delete;
+
+    Connection connect(Slot &&slot)
+    {
+        const auto id = ++m_state->lastId;
+        auto &entries = m_state->dispatchDepth > 0 ? m_state->pending : m_state->entries;
+        entries.push_back({id, std::move(slot)});
+        return Connection{m_state, id};
+    }
+
+    void emit(Args... args)
+    {
+        auto &state = *m_state;
+        ++state.dispatchDepth;
+        for (auto i = std::size_t{0}, count = state.entries.size(); i < count; ++i) {
+            if (state.entries[i].active) {
+                state.entries[i].slot(args...);
+            }
+        }
+        if (--state.dispatchDepth == 0) {
+            state.compact();
+        }
+    }
+
+    std::size_t size() const
+    {
+        return std::ranges::count_if(m_state->entries, &Entry::active)
+               + m_state->pending.size();
+    }
+
+private:
+    struct Entry
+    {
+        std::uint64_t id{};
+        Slot slot;
+        bool active{true};
+    };
+
+    struct State : SignalState
+    {
+        bool connected(std::uint64_t id) const override
+        {
+            const auto *entry = find(entries, id);
+            return (entry && entry->active) || find(pending, id);
+        }
+
+        void disconnect(std::uint64_t id) override
+        {
+            if (const auto *entry = find(pending, id)) {
+                pending.erase(std::cbegin(pending) + (entry - pending.data()));
+                return;
+            }
+            auto *entry = find(entries, id);
+            if (!entry) {
+                return;
+            }
+            if (dispatchDepth > 0) {
+                entry->active = false;
+                needsCompaction = true;
+            } else {
+                entries.erase(std::cbegin(entries) + (entry - entries.data()));
+            }
+        }
+
+        void compact()
+        {
+            if (needsCompaction) {
+                std::erase_if(entries, [](const auto &entry) { return !entry.active; });
+                needsCompaction = false;
+            }
+            std::ranges::move(pending, std::back_inserter(entries));
+            pending.clear();
+        }
+
+        static Entry *find(const std::vector<Entry> &entries, std::uint64_t id)
+        {
+            const auto it = std::ranges::lower_bound(entries, id, {}, &Entry::id);
+            return it != std::cend(entries) && it->id == id ? const_cast<Entry *>(&*it) : nullptr;
+        }
+
+        std::vector<Entry> entries;
+        std::vector<Entry> pending;
+        std::uint64_t lastId{};
+        int dispatchDepth{};
+        bool needsCompaction{};
+    };
+
+    std::shared_ptr<State> m_state;
+};
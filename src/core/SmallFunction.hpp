@@ -0,0 +1,93 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+constexpr auto DefaultSmallFunctionCapacity = 4 * sizeof(void *);
+
+template<typename Signature, std::size_t Capacity = DefaultSmallFunctionCapacity>
+class SmallFunction;
+
+template<typename R, typename... Args, std::size_t Capacity>
+class SmallFunction<R(Args...), Capacity>
+{
+public:
+    SmallFunction() = default;
+
+    template<typename F>
+        requires(!std::same_as<std::remove_cvref_t<F>, SmallFunction> && std::invocable<std::decay_t<F> &, Args...>)
+    SmallFunction(F &&function)
+    {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= Capacity, "callable does not fit into SmallFunction storage");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "callable is over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<Callable>, "callable must be nothrow movable");
+        ::new (static_cast<void *>(m_storage)) Callable(std::forward<F>(function));
+        m_operations = &OperationsFor<Callable>;
+    }
+
+    SmallFunction(SmallFunction &&other) noexcept { moveFrom(other); }
+
+    SmallFunction &operator=(SmallFunction &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    SmallFunction(const SmallFunction &) = delete;
+    SmallFunction &operator=(const SmallFunction &) = delete;
+
+    ~SmallFunction() { reset(); }
+
+    explicit operator bool() const { return m_operations != nullptr; }
+
+    R operator()(Args... args) const
+    {
+        return m_operations->invoke(const_cast<std::byte *>(m_storage), std::forward<Args>(args)...);
+    }
+
+    void reset()
+    {
+        if (m_operations) {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+private:
+    struct Operations
+    {
+        R (*invoke)(void *, Args &&...);
+        void (*move)(void *, void *) noexcept;
+        void (*destroy)(void *) noexcept;
+    };
+
+    template<typename Callable>
+    static constexpr Operations OperationsFor{
+        .invoke = [](void *storage, Args &&...args) -> R {
+            return (*static_cast<Callable *>(storage))(std::forward<Args>(args)...);
+        },
+        .move =
+            [](void *destination, void *source) noexcept {
+                ::new (destination) Callable(std::move(*static_cast<Callable *>(source)));
+                static_cast<Callable *>(source)->~Callable();
+            },
+        .destroy = [](void *storage) noexcept { static_cast<Callable *>(storage)->~Callable(); }};
+
+    void moveFrom(SmallFunction &other) noexcept
+    {
+        if (other.m_operations) {
+            other.m_operations->move(m_storage, other.m_storage);
+            m_operations = std::exchange(other.m_operations, nullptr);
+        }
+    }
+
+    alignas(std::max_align_t) std::byte m_storage[Capacity];
+    const Operations *m_operations{};
+};
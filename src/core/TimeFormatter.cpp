@@ -0,0 +1,63 @@
+#include "TimeFormatter.hpp"
+#include <charconv>
+
+namespace {
+char *writeNumber(char *first, char *last, std::int64_t value, int minimumDigits)
+{
+    for (auto limit = std::int64_t{10}; minimumDigits > 1 && value < limit; limit *= 10, --minimumDigits) {
+        *first++ = '0';
+    }
+    return std::to_chars(first, last, value).ptr;
+}
+
+char *writeTime(char *first, char *last, std::chrono::seconds time, bool withHours)
+{
+    const auto seconds = time.count();
+    if (withHours) {
+        first = writeNumber(first, last, seconds / 3600, 1);
+        *first++ = ':';
+        first = writeNumber(first, last, seconds / 60 % 60, 2);
+    } else {
+        first = writeNumber(first, last, seconds / 60, 1);
+    }
+    *first++ = ':';
+    return writeNumber(first, last, seconds % 60, 2);
+}
+} // namespace
+
+bool TimeFormatter::update(std::chrono::milliseconds currentTime, std::chrono::milliseconds duration)
+{
+    const auto currentSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime);
+    const auto durationSeconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+    if (currentSeconds == m_currentTime && durationSeconds == m_duration) {
+        return false;
+    }
+    m_currentTime = currentSeconds;
+    m_duration = durationSeconds;
+
+    const auto withHours = durationSeconds >= std::chrono::hours{1};
+    auto *const last = m_buffer.data() + m_buffer.size();
+    auto *position = writeTime(m_buffer.data(), last, currentSeconds, withHours);
+    for (const auto character : std::string_view{" / "}) {
+        *position++ = character;
+    }
+    position = writeTime(position, last, durationSeconds, withHours);
+    m_size = position - m_buffer.data();
+    return true;
+}
+
+bool TimeFormatter::clear()
+{
+    if (m_size == 0) {
+        return false;
+    }
+    m_size = 0;
+    m_currentTime = std::chrono::seconds{-1};
+    m_duration = std::chrono::seconds{-1};
+    return true;
+}
+
+std::string_view TimeFormatter::text() const
+{
+    return {m_buffer.data(), m_size};
+}
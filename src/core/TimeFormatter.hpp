@@ -0,0 +1,22 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+class TimeFormatter
+{
+public:
+    static constexpr auto Capacity = std::size_t{48};
+
+    bool update(std::chrono::milliseconds currentTime, std::chrono::milliseconds duration);
+    bool clear();
+
+    std::string_view text() const;
+
+private:
+    std::array<char, Capacity> m_buffer{};
+    std::size_t m_size{};
+    std::chrono::seconds m_currentTime{-1};
+    std::chrono::seconds m_duration{-1};
+};
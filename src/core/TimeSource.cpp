@@ -0,0 +1,16 @@
+#include "TimeSource.hpp"
+
+std::chrono::nanoseconds SteadyTimeSource::now() const
+{
+    return std::chrono::steady_clock::now().time_since_epoch();
+}
+
+std::chrono::nanoseconds VirtualTimeSource::now() const
+{
+    return m_now;
+}
+
+void VirtualTimeSource::advance(std::chrono::nanoseconds interval)
+{
+    m_now += interval;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+
+class TimeSource
+{
+public:
+    virtual ~TimeSource() = default;
+
+    virtual std::chrono::nanoseconds now() const = 0;
+};
+
+class SteadyTimeSource : public TimeSource
+{
+public:
+    std::chrono::nanoseconds now() const override;
+};
+
+class VirtualTimeSource : public TimeSource
+{
+public:
+    std::chrono::nanoseconds now() const override;
+
+    void advance(std::chrono::nanoseconds interval);
+
+private:
+    std::chrono::nanoseconds m_now{};
+};
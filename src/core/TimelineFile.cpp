@@ -0,0 +1,219 @@
+#include "TimelineFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+
+namespace {
+using Error = TimelineFile::Error;
+
+static_assert(sizeof(TimelineFile::Header) == 40);
+
+std::unexpected<Error> error(Error::Code code, std::string message)
+{
+    return std::unexpected{Error{.code = code, .message = std::move(message)}};
+}
+
+template<typename T>
+char *append(char *output, const T &value)
+{
+    std::memcpy(output, &value, sizeof(T));
+    return output + sizeof(T);
+}
+} // namespace
+
+std::string TimelineFile::Error::describe() const
+{
+    return message;
+}
+
+std::expected<std::string, TimelineFile::Error> TimelineFile::serialize(const FilmDetails &details)
+{
+    auto stringTableSize = details.name.size();
+    for (const auto &chapter : details.chapters) {
+        stringTableSize += chapter.name.size();
+    }
+    if (stringTableSize > std::numeric_limits<std::uint32_t>::max()) {
+        return error(Error::Code::TooLarge, "chapter names do not fit in a 4 GiB string table");
+    }
+    const auto header = Header{
+        .magic = Magic,
+        .version = Version,
+        .byteOrder = ByteOrder,
+        .headerSize = sizeof(Header),
+        .duration = details.duration.count(),
+        .chapterCount = details.chapters.size(),
+        .nameSize = std::uint32_t(details.name.size()),
+        .stringTableSize = std::uint32_t(stringTableSize)};
+    const auto count = details.chapters.size();
+    auto bytes = std::string(
+        sizeof(Header) + count * 2 * sizeof(std::int64_t) + (count + 1) * sizeof(std::uint32_t) + stringTableSize,
+        '\0');
+    auto *output = append(bytes.data(), header);
+    for (const auto &chapter : details.chapters) {
+        output = append(output, std::int64_t{chapter.startTime.count()});
+    }
+    for (const auto &chapter : details.chapters) {
+        output = append(output, std::int64_t{chapter.endTime.count()});
+    }
+    auto offset = header.nameSize;
+    for (const auto &chapter : details.chapters) {
+        output = append(output, offset);
+        offset += std::uint32_t(chapter.name.size());
+    }
+    output = append(output, offset);
+    output = std::ranges::copy(details.name, output).out;
+    for (const auto &chapter : details.chapters) {
+        output = std::ranges::copy(chapter.name, output).out;
+    }
+    return bytes;
+}
+
+std::expected<void, TimelineFile::Error> TimelineFile::write(
+    const std::filesystem::path &path, const FilmDetails &details)
+{
+    const auto bytes = serialize(details);
+    if (!bytes) {
+        return std::unexpected{bytes.error()};
+    }
+    auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    if (!stream.write(bytes->data(), std::streamsize(bytes->size())) || !stream.flush()) {
+        return error(Error::Code::WriteFailed, std::format("cannot write {}", path.string()));
+    }
+    return {};
+}
+
+std::expected<TimelineFile, TimelineFile::Error> TimelineFile::load(const std::filesystem::path &path)
+{
+    auto file = MappedFile::open(path);
+    if (!file) {
+        return error(Error::Code::OpenFailed, std::format("cannot open {}: {}", path.string(), file.error().message()));
+    }
+    auto timeline = view(file->contents());
+    if (timeline) {
+        timeline->m_file = std::move(*file);
+    }
+    return timeline;
+}
+
+std::expected<TimelineFile, TimelineFile::Error> TimelineFile::view(std::string_view bytes)
+{
+    auto timeline = TimelineFile{};
+    auto &header = timeline.m_header;
+    if (bytes.size() < sizeof(Header)) {
+        return error(Error::Code::Truncated, "file is shorter than the timeline header");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(Header));
+    if (header.magic != Magic) {
+        return error(Error::Code::BadMagic, "not a seekbar timeline file");
+    }
+    if (header.byteOrder != ByteOrder) {
+        return error(Error::Code::ByteOrderMismatch, "timeline was written with a different byte order");
+    }
+    if (header.version != Version) {
+        return error(
+            Error::Code::UnsupportedVersion,
+            std::format("timeline version {} is not supported (expected {})", header.version, Version));
+    }
+    if (header.headerSize < sizeof(Header) || header.headerSize % alignof(std::int64_t) != 0
+        || reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(std::int64_t) != 0) {
+        return error(Error::Code::Corrupt, "timeline sections are not 8-byte aligned");
+    }
+    if (header.headerSize > bytes.size()) {
+        return error(Error::Code::Truncated, "file is shorter than the timeline header");
+    }
+    const auto count = header.chapterCount;
+    constexpr auto BytesPerChapter = 2 * sizeof(std::int64_t) + sizeof(std::uint32_t);
+    if (count > (bytes.size() - header.headerSize) / BytesPerChapter) {
+        return error(Error::Code::Truncated, std::format("file is too short for {} chapters", count));
+    }
+    const auto expectedSize = header.headerSize + count * BytesPerChapter + sizeof(std::uint32_t)
+                              + std::size_t{header.stringTableSize};
+    if (bytes.size() != expectedSize) {
+        return error(
+            bytes.size() < expectedSize ? Error::Code::Truncated : Error::Code::Corrupt,
+            std::format("timeline should be {} bytes long but is {}", expectedSize, bytes.size()));
+    }
+
+    const auto *const data = bytes.data() + header.headerSize;
+    timeline.m_startTimes = reinterpret_cast<const std::int64_t *>(data);
+    timeline.m_endTimes = timeline.m_startTimes + count;
+    timeline.m_nameOffsets = reinterpret_cast<const std::uint32_t *>(timeline.m_endTimes + count);
+    timeline.m_strings = reinterpret_cast<const char *>(timeline.m_nameOffsets + count + 1);
+
+    if (header.nameSize > header.stringTableSize || timeline.m_nameOffsets[0] != header.nameSize
+        || timeline.m_nameOffsets[count] != header.stringTableSize) {
+        return error(Error::Code::Corrupt, "string table offsets are out of range");
+    }
+    if (header.duration < 0) {
+        return error(Error::Code::Corrupt, "timeline has a negative duration");
+    }
+    auto previousEnd = std::int64_t{0};
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto start = timeline.m_startTimes[i];
+        const auto end = timeline.m_endTimes[i];
+        if (start < previousEnd || end <= start || end > header.duration) {
+            return error(Error::Code::Corrupt, std::format("chapter {} has an invalid time range", i));
+        }
+        if (timeline.m_nameOffsets[i + 1] < timeline.m_nameOffsets[i]) {
+            return error(Error::Code::Corrupt, std::format("chapter {} has an invalid name offset", i));
+        }
+        previousEnd = end;
+    }
+    return timeline;
+}
+
+std::string_view TimelineFile::name() const
+{
+    return {m_strings, m_header.nameSize};
+}
+
+std::chrono::milliseconds TimelineFile::duration() const
+{
+    return std::chrono::milliseconds{m_header.duration};
+}
+
+std::size_t TimelineFile::size() const
+{
+    return m_header.chapterCount;
+}
+
+std::chrono::milliseconds TimelineFile::startTime(std::size_t index) const
+{
+    return std::chrono::milliseconds{m_startTimes[index]};
+}
+
+std::chrono::milliseconds TimelineFile::endTime(std::size_t index) const
+{
+    return std::chrono::milliseconds{m_endTimes[index]};
+}
+
+std::string_view TimelineFile::chapterName(std::size_t index) const
+{
+    return {m_strings + m_nameOffsets[index], m_nameOffsets[index + 1] - m_nameOffsets[index]};
+}
+
+FilmDetails TimelineFile::filmDetails(const std::pmr::polymorphic_allocator<> &allocator) const
+{
+    auto details = FilmDetails{
+        .name = std::pmr::string{name(), allocator},
+        .duration = duration(),
+        .chapters = std::pmr::vector<FilmDetails::ChapterDetails>{allocator},
+        .keyframes = KeyframeIndex{allocator}};
+    details.chapters.reserve(size());
+    for (auto i = std::size_t{0}; i < size(); ++i) {
+        details.chapters.push_back(
+            {.name = std::pmr::string{chapterName(i), allocator}, .startTime = startTime(i), .endTime = endTime(i)});
+    }
+    return details;
+}
+
+std::shared_ptr<FilmDetails> TimelineFile::sharedFilmDetails() const
+{
+    auto details = FilmDetails::allocateShared(
+        sizeof(FilmDetails::ChapterDetails) * size() + m_header.stringTableSize + size() + 1);
+    // Built with the arena's allocator, so moving the copy in takes over its storage.
+    *details = filmDetails(details->chapters.get_allocator());
+    return details;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "FilmDetails.hpp"
+#include "MappedFile.hpp"
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+// Preprocessed FilmDetails that can be mapped and read in place. After the header come the chapter start
+// times, the chapter end times (both int64 milliseconds), chapterCount + 1 uint32 offsets into the string
+// table, and the string table itself, which begins with the film name. Values are stored in the writer's
+// byte order, which the reader checks against byteOrder.
+class TimelineFile
+{
+public:
+    struct Header
+    {
+        std::array<char, 8> magic{};
+        std::uint16_t version{};
+        std::uint16_t byteOrder{};
+        std::uint32_t headerSize{};
+        std::int64_t duration{};
+        std::uint64_t chapterCount{};
+        std::uint32_t nameSize{};
+        std::uint32_t stringTableSize{};
+    };
+
+    struct Error
+    {
+        enum class Code {
+            OpenFailed,
+            WriteFailed,
+            TooLarge,
+            Truncated,
+            BadMagic,
+            ByteOrderMismatch,
+            UnsupportedVersion,
+            Corrupt
+        };
+
+        Code code{};
+        std::string message;
+
+        std::string describe() const;
+    };
+
+    static constexpr std::array<char, 8> Magic{'S', 'E', 'E', 'K', 'B', 'A', 'R', 'T'};
+    static constexpr std::uint16_t Version = 1;
+    static constexpr std::uint16_t ByteOrder = 0x0102;
+
+    static std::expected<std::string, Error> serialize(const FilmDetails &details);
+    static std::expected<void, Error> write(const std::filesystem::path &path, const FilmDetails &details);
+    static std::expected<TimelineFile, Error> load(const std::filesystem::path &path);
+    // The returned file points into bytes, which must outlive it.
+    static std::expected<TimelineFile, Error> view(std::string_view bytes);
+
+    std::string_view name() const;
+    std::chrono::milliseconds duration() const;
+    std::size_t size() const;
+    std::chrono::milliseconds startTime(std::size_t index) const;
+    std::chrono::milliseconds endTime(std::size_t index) const;
+    std::string_view chapterName(std::size_t index) const;
+
+    // Copies the name of every chapter: FilmController and SeekBar still work on owning FilmDetails, so the
+    // mapped view only saves parsing and validation, not the per-chapter allocations.
+    FilmDetails filmDetails(const std::pmr::polymorphic_allocator<> &allocator = {}) const;
+    // The same copy made straight into a FilmDetails::allocateShared arena sized for it, ready for FilmController.
+    std::shared_ptr<FilmDetails> sharedFilmDetails() const;
+
+private:
+    MappedFile m_file;
+    Header m_header;
+    const std::int64_t *m_startTimes{};
+    const std::int64_t *m_endTimes{};
+    const std::uint32_t *m_nameOffsets{};
+    const char *m_strings{};
+};
@@ -5,66 +5,63 @@ constexpr auto MinimizedHeight = 3;
 const auto BackgroundColor = sf::Color{180, 180, 180, 100};
 const auto FilledColor = sf::Color{255, 50, 50};
 
-Chapter::Chapter(const FilmDetails::ChapterDetails &details)
-    : m_details{details}
+namespace {
+void writeRect(sf::Vertex *vertices, sf::Vector2f position, sf::Vector2f size, sf::Color color)
 {
-    m_backgroundShape.setFillColor(BackgroundColor);
-    m_filledShape.setFillColor(FilledColor);
-    m_label.setText(m_details.name);
+    const auto topLeft = position;
+    const auto topRight = position + sf::Vector2f{size.x, 0};
+    const auto bottomLeft = position + sf::Vector2f{0, size.y};
+    const auto bottomRight = position + size;
+    for (const auto corner : {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight}) {
+        *vertices++ = sf::Vertex{corner, color};
+    }
 }
+} // namespace
 
-FilmDetails::ChapterDetails Chapter::details() const
+Chapter::Chapter(const FilmDetails::ChapterDetails &details)
+    : m_details{&details}
+{}
+
+const FilmDetails::ChapterDetails &Chapter::details() const
 {
-    return m_details;
+    return *m_details;
 }
 
 float Chapter::filled() const
 {
-    return m_filledShape.getSize().x / size().x;
+    return m_filled;
 }
 
 void Chapter::setFilled(float filled)
 {
-    m_filledShape.setSize({filled * size().x, getHeight()});
+    if (filled == m_filled) {
+        return;
+    }
+    m_filled = filled;
+    markDirty();
 }
 
 void Chapter::draw(sf::RenderTarget &target, sf::RenderStates states) const
 {
-    states.transform *= getTransform();
-    target.draw(m_backgroundShape, states);
-    target.draw(m_filledShape, states);
-    if (hovered()) {
-        target.draw(m_label, states);
-    }
+    sf::Vertex vertices[VertexCount];
+    writeVertices(vertices);
+    target.draw(vertices, VertexCount, sf::Triangles, states);
 }
 
-void Chapter::updateGeometry()
+void Chapter::writeVertices(sf::Vertex *vertices) const
 {
-    m_backgroundShape.setSize({size().x, getHeight()});
-    m_filledShape.setSize({m_filledShape.getSize().x, getHeight()});
-    m_label.setPosition(
-        size().x / 2 - m_label.getGlobalBounds().width / 2,
-        size().y / 2 - m_label.getGlobalBounds().height / 2 - FullHeight * 3);
-
-    updateHeight();
+    const auto track = trackRect();
+    writeRect(vertices, track.getPosition(), track.getSize(), BackgroundColor);
+    writeRect(vertices + VertexCount / 2, track.getPosition(), {m_filled * track.width, track.height}, FilledColor);
 }
 
-void Chapter::onHoveredChanged()
+sf::FloatRect Chapter::trackRect() const
 {
-    updateHeight();
+    const auto height = getHeight();
+    return {getPosition() + sf::Vector2f{0, (size().y - height) / 2}, {size().x, height}};
 }
 
 float Chapter::getHeight() const
 {
     return hovered() ? FullHeight : MinimizedHeight;
 }
-
-void Chapter::updateHeight()
-{
-    auto updateShape = [&](auto &shape) {
-        shape.setSize({shape.getSize().x, getHeight()});
-        shape.setPosition({shape.getPosition().x, (size().y - (hovered() ? FullHeight : MinimizedHeight)) / 2.f});
-    };
-    updateShape(m_backgroundShape);
-    updateShape(m_filledShape);
-}
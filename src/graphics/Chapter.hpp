@@ -1,29 +1,27 @@
 #pragma once
 
 #include "FilmDetails.hpp"
-#include "Label.hpp"
+#include "UiElement.hpp"
 
 class Chapter : public UiElement
 {
 public:
+    static constexpr auto VertexCount = 12;
+
     explicit Chapter(const FilmDetails::ChapterDetails &details);
 
-    FilmDetails::ChapterDetails details() const;
+    const FilmDetails::ChapterDetails &details() const;
 
     float filled() const;
     void setFilled(float filled);
 
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
+    void writeVertices(sf::Vertex *vertices) const;
+    sf::FloatRect trackRect() const;
 
 private:
-    void updateGeometry() override;
-    void onHoveredChanged() override;
-
     float getHeight() const;
-    void updateHeight();
 
-    FilmDetails::ChapterDetails m_details;
-    sf::RectangleShape m_backgroundShape;
-    sf::RectangleShape m_filledShape;
-    Label m_label;
+    const FilmDetails::ChapterDetails *m_details;
+    float m_filled{};
 };
@@ -1,23 +1,28 @@
 #include "CurrrentTimeLabel.hpp"
-#include <format>
 
 CurrentTimeLabel::CurrentTimeLabel(FilmController &controller)
     : m_controller{controller}
 {
-    auto updateText = [this] {
-        auto formatTime = [](auto time) {
-            return std::format(
-                "{}:{:0>2}",
-                std::chrono::duration_cast<std::chrono::minutes>(time).count(),
-                std::chrono::duration_cast<std::chrono::seconds>(time).count() % 60);
-        };
-        setText(
-            m_controller.loading()
-                ? ""
-                : std::format(
-                    "{} / {}", formatTime(m_controller.currentTime()), formatTime(m_controller.filmDetails().duration)));
-    };
-    m_controller.onCurrentTimeChanged(updateText);
-    m_controller.onStateChanged(updateText);
+    m_currentTimeConnection = m_controller.onCurrentTimeChanged(std::chrono::seconds{1}, [this] { updateText(); });
+    m_stateConnection = m_controller.onStateChanged([this] { updateText(); });
+    m_filmDetailsConnection = m_controller.onFilmDetailsChanged([this] { updateText(); });
     updateText();
 }
+
+void CurrentTimeLabel::scheduleWakeUp(Scheduler &scheduler) const
+{
+    if (m_controller.playing()) {
+        constexpr auto Second = std::chrono::milliseconds{std::chrono::seconds{1}};
+        scheduler.wakeUpIn(Second - m_controller.currentTime() % Second);
+    }
+}
+
+void CurrentTimeLabel::updateText()
+{
+    const auto changed = !m_controller.seekable()
+                             ? m_formatter.clear()
+                             : m_formatter.update(m_controller.currentTime(), m_controller.filmDetails().duration);
+    if (changed) {
+        setText(m_formatter.text());
+    }
+}
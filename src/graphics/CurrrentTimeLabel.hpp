@@ -2,12 +2,21 @@
 
 #include "FilmController.hpp"
 #include "Label.hpp"
+#include "TimeFormatter.hpp"
 
 class CurrentTimeLabel : public Label
 {
 public:
     explicit CurrentTimeLabel(FilmController &controller);
 
+    void scheduleWakeUp(Scheduler &scheduler) const override;
+
 private:
+    void updateText();
+
     FilmController &m_controller;
+    TimeFormatter m_formatter;
+    ScopedConnection m_currentTimeConnection;
+    ScopedConnection m_stateConnection;
+    ScopedConnection m_filmDetailsConnection;
 };
\ No newline at end of file
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstddef>
+
+extern const unsigned char EmbeddedFontData[];
+extern const std::size_t EmbeddedFontSize;
@@ -0,0 +1,224 @@
+#include "FlatTree.hpp"
+#include <algorithm>
+#include <span>
+#include <utility>
+
+void FlatTree::rebuild(UiElement &root)
+{
+    m_rects.clear();
+    m_flags.clear();
+    m_parents.clear();
+    m_nextSiblings.clear();
+    m_elements.clear();
+    m_childrenBegin.clear();
+    m_childrenEnd.clear();
+    m_children.clear();
+    m_childExtents.clear();
+    m_hoveredNode.reset();
+    m_pressedNode.reset();
+    append(root, NoNode);
+    sync();
+}
+
+void FlatTree::updateLayout()
+{
+    if (m_elements.empty() || m_elements.front()->layoutValid()) {
+        return;
+    }
+    m_elements.front()->updateLayout();
+    sync();
+}
+
+void FlatTree::sync()
+{
+    for (auto node = std::size_t{0}; node < m_elements.size(); ++node) {
+        m_rects[node] = {origin(node) + m_elements[node]->getPosition(), m_elements[node]->size()};
+    }
+    for (auto node = std::size_t{0}; node < m_elements.size(); ++node) {
+        updateChildExtents(node);
+    }
+}
+
+std::size_t FlatTree::size() const
+{
+    return m_elements.size();
+}
+
+UiElement &FlatTree::element(std::size_t node) const
+{
+    return *m_elements[node];
+}
+
+std::uint32_t FlatTree::parent(std::size_t node) const
+{
+    return m_parents[node];
+}
+
+std::uint32_t FlatTree::nextSibling(std::size_t node) const
+{
+    return m_nextSiblings[node];
+}
+
+const sf::FloatRect &FlatTree::rect(std::size_t node) const
+{
+    return m_rects[node];
+}
+
+std::uint8_t FlatTree::flags(std::size_t node) const
+{
+    return m_flags[node];
+}
+
+std::optional<std::size_t> FlatTree::hitTest(sf::Vector2f point) const
+{
+    if (m_rects.empty() || !m_rects.front().contains(point)) {
+        return std::nullopt;
+    }
+    auto node = std::size_t{0};
+    while (const auto child = childAt(node, point)) {
+        node = *child;
+    }
+    return node;
+}
+
+void FlatTree::draw(sf::RenderTarget &target, sf::RenderStates states) const
+{
+    for (auto node = std::size_t{0}; node < m_elements.size(); ++node) {
+        auto nodeStates = states;
+        nodeStates.transform.translate(origin(node));
+        if (m_flags[node] & Leaf) {
+            target.draw(*m_elements[node], nodeStates);
+        } else {
+            m_elements[node]->UiElement::draw(target, nodeStates);
+        }
+    }
+}
+
+void FlatTree::handleMousePressed(sf::Vector2i mousePosition)
+{
+    m_pressedNode = leafAt(mousePosition);
+    if (m_pressedNode) {
+        m_elements[*m_pressedNode]->handleMousePressed(toParent(*m_pressedNode, mousePosition));
+    }
+}
+
+void FlatTree::handleMouseReleased(sf::Vector2i mousePosition)
+{
+    if (const auto node = std::exchange(m_pressedNode, std::nullopt)) {
+        m_elements[*node]->handleMouseReleased(toParent(*node, mousePosition));
+    }
+}
+
+void FlatTree::handleMouseMoved(sf::Vector2i mousePosition)
+{
+    const auto node = leafAt(mousePosition);
+    if (m_hoveredNode && m_hoveredNode != node) {
+        m_elements[*m_hoveredNode]->handleMouseMoved(toParent(*m_hoveredNode, mousePosition));
+    }
+    if (m_pressedNode && m_pressedNode != node && m_pressedNode != m_hoveredNode) {
+        m_elements[*m_pressedNode]->handleMouseMoved(toParent(*m_pressedNode, mousePosition));
+    }
+    m_hoveredNode = node;
+    if (node) {
+        m_elements[*node]->handleMouseMoved(toParent(*node, mousePosition));
+    }
+}
+
+void FlatTree::handleMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta)
+{
+    if (const auto node = leafAt(mousePosition)) {
+        m_elements[*node]->handleMouseWheelScrolled(toParent(*node, mousePosition), wheel, delta);
+    }
+}
+
+void FlatTree::append(UiElement &element, std::uint32_t parent)
+{
+    const auto node = std::uint32_t(m_elements.size());
+    m_rects.emplace_back();
+    m_flags.push_back(element.childCount() == 0 ? Leaf : 0);
+    m_parents.push_back(parent);
+    m_nextSiblings.push_back(NoNode);
+    m_elements.push_back(&element);
+    const auto childrenBegin = std::uint32_t(m_children.size());
+    m_childrenBegin.push_back(childrenBegin);
+    m_childrenEnd.push_back(childrenBegin + std::uint32_t(element.childCount()));
+    m_children.resize(m_childrenEnd.back());
+    m_childExtents.resize(m_childrenEnd.back());
+    for (auto previous = NoNode, index = std::uint32_t{0}; index < element.childCount(); ++index) {
+        const auto child = std::uint32_t(m_elements.size());
+        if (previous != NoNode) {
+            m_nextSiblings[previous] = child;
+        }
+        m_children[childrenBegin + index] = child;
+        append(*element.child(index), node);
+        previous = child;
+    }
+}
+
+std::uint32_t FlatTree::firstChild(std::size_t node) const
+{
+    const auto next = node + 1;
+    return next < m_parents.size() && m_parents[next] == node ? std::uint32_t(next) : NoNode;
+}
+
+std::optional<std::size_t> FlatTree::childAt(std::size_t node, sf::Vector2f point) const
+{
+    const auto begin = std::next(m_children.cbegin(), m_childrenBegin[node]);
+    const auto end = std::next(m_children.cbegin(), m_childrenEnd[node]);
+    if (!(m_flags[node] & (ChildrenAlongX | ChildrenAlongY))) {
+        const auto child = std::find_if(begin, end, [&](auto child) { return m_rects[child].contains(point); });
+        return child == end ? std::nullopt : std::optional<std::size_t>{*child};
+    }
+    const auto extents = std::span{m_childExtents}.subspan(m_childrenBegin[node], std::size_t(end - begin));
+    const auto extent = std::ranges::upper_bound(extents, m_flags[node] & ChildrenAlongX ? point.x : point.y);
+    if (extent == extents.end()) {
+        return std::nullopt;
+    }
+    const auto child = begin[extent - extents.begin()];
+    return m_rects[child].contains(point) ? std::optional<std::size_t>{child} : std::nullopt;
+}
+
+// Children laid out by a Layout are ordered along its axis; anything else falls back to testing each child.
+void FlatTree::updateChildExtents(std::size_t node)
+{
+    const auto begin = m_childrenBegin[node];
+    const auto end = m_childrenEnd[node];
+    const auto orderedAlong = [&](auto edge) {
+        for (auto i = begin; i + 1 < end; ++i) {
+            if (edge(m_rects[m_children[i + 1]]).first < edge(m_rects[m_children[i]]).second) {
+                return false;
+            }
+        }
+        return true;
+    };
+    const auto horizontal = [](const sf::FloatRect &rect) { return std::pair{rect.left, rect.left + rect.width}; };
+    const auto vertical = [](const sf::FloatRect &rect) { return std::pair{rect.top, rect.top + rect.height}; };
+    m_flags[node] &= ~(ChildrenAlongX | ChildrenAlongY);
+    if (orderedAlong(horizontal)) {
+        m_flags[node] |= ChildrenAlongX;
+        for (auto i = begin; i < end; ++i) {
+            m_childExtents[i] = horizontal(m_rects[m_children[i]]).second;
+        }
+    } else if (orderedAlong(vertical)) {
+        m_flags[node] |= ChildrenAlongY;
+        for (auto i = begin; i < end; ++i) {
+            m_childExtents[i] = vertical(m_rects[m_children[i]]).second;
+        }
+    }
+}
+
+sf::Vector2f FlatTree::origin(std::size_t node) const
+{
+    return m_parents[node] == NoNode ? sf::Vector2f{} : m_rects[m_parents[node]].getPosition();
+}
+
+sf::Vector2i FlatTree::toParent(std::size_t node, sf::Vector2i mousePosition) const
+{
+    return mousePosition - sf::Vector2i{origin(node)};
+}
+
+std::optional<std::size_t> FlatTree::leafAt(sf::Vector2i mousePosition) const
+{
+    const auto node = hitTest(sf::Vector2f{mousePosition});
+    return node && m_flags[*node] & Leaf ? node : std::nullopt;
+}
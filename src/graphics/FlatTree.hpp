@@ -0,0 +1,69 @@
+#pragma once
+
+#include "UiElement.hpp"
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// Mirrors the element tree in depth-first arrays for hit testing and drawing. Children are discovered through
+// childCount()/child(), which SeekBar does not implement: its chapters are batched into one vertex array and
+// rebuilt whenever the view changes, so they stay out of the flat tree and SeekBar finds the chapter under the
+// cursor with its own binary search.
+class FlatTree : public sf::Drawable
+{
+public:
+    static constexpr auto NoNode = std::numeric_limits<std::uint32_t>::max();
+
+    // ChildrenAlongX/Y: the children do not overlap and are ordered along that axis, so hitTest() can
+    // binary-search their far edges instead of testing each one.
+    enum Flag : std::uint8_t {
+        Leaf = 1 << 0,
+        ChildrenAlongX = 1 << 1,
+        ChildrenAlongY = 1 << 2,
+    };
+
+    // Measure and arrange still run on the element tree; updateLayout() copies their results into the flat
+    // arrays only on frames where they ran. Call sync() after moving an element outside of a layout pass.
+    void rebuild(UiElement &root);
+    void updateLayout();
+    void sync();
+
+    std::size_t size() const;
+    UiElement &element(std::size_t node) const;
+    std::uint32_t parent(std::size_t node) const;
+    std::uint32_t nextSibling(std::size_t node) const;
+    const sf::FloatRect &rect(std::size_t node) const;
+    std::uint8_t flags(std::size_t node) const;
+
+    std::optional<std::size_t> hitTest(sf::Vector2f point) const;
+
+    void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
+
+    void handleMousePressed(sf::Vector2i mousePosition);
+    void handleMouseReleased(sf::Vector2i mousePosition);
+    void handleMouseMoved(sf::Vector2i mousePosition);
+    void handleMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta);
+
+private:
+    void append(UiElement &element, std::uint32_t parent);
+    std::uint32_t firstChild(std::size_t node) const;
+    std::optional<std::size_t> childAt(std::size_t node, sf::Vector2f point) const;
+    void updateChildExtents(std::size_t node);
+    sf::Vector2f origin(std::size_t node) const;
+    sf::Vector2i toParent(std::size_t node, sf::Vector2i mousePosition) const;
+    std::optional<std::size_t> leafAt(sf::Vector2i mousePosition) const;
+
+    std::vector<sf::FloatRect> m_rects;
+    std::vector<std::uint8_t> m_flags;
+    std::vector<std::uint32_t> m_parents;
+    std::vector<std::uint32_t> m_nextSiblings;
+    std::vector<UiElement *> m_elements;
+    // The children of every node, grouped per parent, with the far edge of each along the parent's axis.
+    std::vector<std::uint32_t> m_childrenBegin;
+    std::vector<std::uint32_t> m_childrenEnd;
+    std::vector<std::uint32_t> m_children;
+    std::vector<float> m_childExtents;
+    std::optional<std::size_t> m_hoveredNode;
+    std::optional<std::size_t> m_pressedNode;
+};
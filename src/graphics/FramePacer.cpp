@@ -0,0 +1,34 @@
+#include "FramePacer.hpp"
+
+FramePacer::RenderMode FramePacer::renderMode() const
+{
+    return m_renderMode;
+}
+
+void FramePacer::setRenderMode(RenderMode renderMode)
+{
+    m_renderMode = renderMode;
+}
+
+const FramePacer::Stats &FramePacer::stats() const
+{
+    return m_stats;
+}
+
+bool FramePacer::beginFrame(const UiElement &root)
+{
+    if (m_renderMode == RenderMode::OnChange && !root.dirty() && !root.animating()) {
+        ++m_stats.skippedFrames;
+        return false;
+    }
+    return true;
+}
+
+void FramePacer::endFrame(UiElement &root, sf::Time elapsed)
+{
+    root.clearDirty();
+    if (m_stats.renderedFrames == 0) {
+        m_stats.timeToFirstFrame = elapsed;
+    }
+    ++m_stats.renderedFrames;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "UiElement.hpp"
+#include <SFML/System/Time.hpp>
+
+// Decides whether a frame has to be drawn. In OnChange mode a frame is skipped while nothing in the tree is
+// dirty or animating; rendered and skipped frames are counted in both modes.
+class FramePacer
+{
+public:
+    enum class RenderMode { Continuous, OnChange };
+
+    struct Stats
+    {
+        std::size_t renderedFrames{};
+        std::size_t skippedFrames{};
+        sf::Time timeToFirstFrame;
+    };
+
+    RenderMode renderMode() const;
+    void setRenderMode(RenderMode renderMode);
+    const Stats &stats() const;
+
+    bool beginFrame(const UiElement &root);
+    void endFrame(UiElement &root, sf::Time elapsed);
+
+private:
+    RenderMode m_renderMode{RenderMode::OnChange};
+    Stats m_stats;
+};
@@ -0,0 +1,21 @@
+#include "InputQueue.hpp"
+
+void InputQueue::push(const sf::Event &event)
+{
+    ++m_stats.rawEvents;
+    if (event.type == sf::Event::MouseMoved && !m_events.empty() && m_events.back().type == sf::Event::MouseMoved) {
+        m_events.back() = event;
+        return;
+    }
+    m_events.push_back(event);
+}
+
+bool InputQueue::empty() const
+{
+    return m_events.empty();
+}
+
+const InputQueue::Stats &InputQueue::stats() const
+{
+    return m_stats;
+}
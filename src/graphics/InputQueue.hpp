@@ -0,0 +1,34 @@
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+#include <vector>
+
+// Collects the events of one frame. Consecutive MouseMoved events collapse into the latest one, so a fast drag
+// costs one hit test per frame instead of one per reported motion.
+class InputQueue
+{
+public:
+    struct Stats
+    {
+        std::size_t rawEvents{};
+        std::size_t deliveredEvents{};
+    };
+
+    void push(const sf::Event &event);
+    bool empty() const;
+    const Stats &stats() const;
+
+    template<typename Handler>
+    void deliver(Handler &&handler)
+    {
+        for (const auto &event : m_events) {
+            handler(event);
+        }
+        m_stats.deliveredEvents += m_events.size();
+        m_events.clear();
+    }
+
+private:
+    std::vector<sf::Event> m_events;
+    Stats m_stats;
+};
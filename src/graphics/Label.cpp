@@ -1,34 +1,76 @@
 #include "Label.hpp"
+#ifdef SEEKBAR_EMBED_FONT
+#include "EmbeddedFont.hpp"
+#else
 #include <filesystem>
+#endif
 
 constexpr auto FontsDirectory = "fonts";
 constexpr auto FontName = "Arial.ttf";
 constexpr auto FontSize = 16;
+constexpr auto FirstPrewarmedCharacter = sf::Uint32{' '};
+constexpr auto LastPrewarmedCharacter = sf::Uint32{'~'};
 
 Label::Label()
 {
-    static auto font = [&]() {
+    m_text.setFillColor(sf::Color::White);
+    m_text.setFont(font());
+    m_text.setCharacterSize(FontSize);
+}
+
+const sf::Font &Label::font()
+{
+    static const auto font = [] {
         sf::Font font;
+#ifdef SEEKBAR_EMBED_FONT
+        font.loadFromMemory(EmbeddedFontData, EmbeddedFontSize);
+#else
         auto path = std::filesystem::path(std::filesystem::current_path() / FontsDirectory);
         if (!std::filesystem::exists(path)) {
             path = std::filesystem::current_path().parent_path() / FontsDirectory;
         }
         font.loadFromFile(path / FontName);
+#endif
         return font;
     }();
-    m_text.setFillColor(sf::Color::White);
-    m_text.setFont(font);
-    m_text.setCharacterSize(FontSize);
+    return font;
+}
+
+void Label::prewarmGlyphs(const sf::Font &font)
+{
+    for (auto character = FirstPrewarmedCharacter; character <= LastPrewarmedCharacter; ++character) {
+        font.getGlyph(character, FontSize, false);
+    }
+}
+
+const std::string &Label::text() const
+{
+    return m_string;
 }
 
-std::string Label::text() const
+const sf::String &Label::characters() const
 {
-    return m_text.getString();
+    return m_characters;
 }
 
-void Label::setText(const std::string &text)
+// Reuses the capacity of both strings and of the sf::Text copy, so updating a label of similar length does not
+// allocate.
+void Label::setText(std::string_view text)
 {
-    m_text.setString(text);
+    if (text == m_string) {
+        return;
+    }
+    m_string.assign(text);
+    m_characters.clear();
+    // Chapter names arrive as UTF-8. sf::String has no push_back, so decode one code point at a time rather than
+    // through a back_inserter into a second buffer.
+    for (auto it = m_string.cbegin(); it != m_string.cend();) {
+        auto character = sf::Uint32{};
+        it = sf::Utf8::decode(it, m_string.cend(), character);
+        m_characters += character;
+    }
+    m_text.setString(m_characters);
+    markDirty();
 }
 
 sf::FloatRect Label::getGlobalBounds() const
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "UiElement.hpp"
+#include <string>
+#include <string_view>
 
 class Label : public UiElement
 {
@@ -8,13 +10,22 @@ public:
     explicit Label();
     virtual ~Label() = default;
 
-    std::string text() const;
-    void setText(const std::string &text);
+    static const sf::Font &font();
+    // Rasterizes printable ASCII, which covers the time labels and most chapter names, so the work does not
+    // depend on the film. Other glyphs are still added to the atlas on first use.
+    static void prewarmGlyphs(const sf::Font &font = Label::font());
+
+    // The UTF-8 text as set, and the code points decoded from it for sf::Text.
+    const std::string &text() const;
+    const sf::String &characters() const;
+    void setText(std::string_view text);
 
     sf::FloatRect getGlobalBounds() const;
 
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
 
 private:
+    std::string m_string;
+    sf::String m_characters;
     sf::Text m_text;
 };
@@ -1,17 +1,21 @@
 #include "Layout.hpp"
-#include <numeric>
+#include <algorithm>
 #include <ranges>
+#include <utility>
 
-Layout::Layout(Orientation orientation)
+Layout::Layout(Orientation orientation, std::pmr::memory_resource *resource)
     : m_orientation{orientation}
+    , m_entries{resource}
 {
     setFillWidth(orientation == Orientation::Vertical);
-    setFillWidth(orientation == Orientation::Horizontal);
+    setFillHeight(orientation == Orientation::Horizontal);
 }
 
 void Layout::addEntry(std::unique_ptr<UiElement> &&entry)
 {
+    entry->setParent(this);
     m_entries.push_back(std::move(entry));
+    invalidateLayout();
 }
 
 Orientation Layout::orientation() const
@@ -22,6 +26,8 @@ Orientation Layout::orientation() const
 void Layout::setOrientation(Orientation orientation)
 {
     m_orientation = orientation;
+    markDirty();
+    invalidateLayout();
 }
 
 float Layout::spacing() const
@@ -32,6 +38,8 @@ float Layout::spacing() const
 void Layout::setSpacing(float spacing)
 {
     m_spacing = spacing;
+    markDirty();
+    invalidateLayout();
 }
 float Layout::padding() const
 {
@@ -41,6 +49,8 @@ float Layout::padding() const
 void Layout::setPadding(float padding)
 {
     m_padding = padding;
+    markDirty();
+    invalidateLayout();
 }
 
 void Layout::draw(sf::RenderTarget &target, sf::RenderStates states) const
@@ -54,67 +64,105 @@ void Layout::draw(sf::RenderTarget &target, sf::RenderStates states) const
 
 void Layout::show()
 {
-    recalculateSizes();
+    updateLayout();
     for (const auto &entry : m_entries) {
         entry->show();
     }
 }
 
-void Layout::handleMousePressed(sf::Vector2i mousePosition)
+void Layout::clearDirty()
 {
-    mousePosition -= sf::Vector2i{getPosition()};
+    UiElement::clearDirty();
     for (const auto &entry : m_entries) {
-        entry->handleMousePressed(mousePosition);
+        entry->clearDirty();
     }
 }
 
-void Layout::handleMouseReleased(sf::Vector2i mousePosition)
+bool Layout::animating() const
+{
+    return std::ranges::any_of(m_entries, [](const auto &entry) { return entry->animating(); });
+}
+
+void Layout::scheduleWakeUp(Scheduler &scheduler) const
 {
-    mousePosition -= sf::Vector2i{getPosition()};
     for (const auto &entry : m_entries) {
-        entry->handleMouseReleased(mousePosition);
+        entry->scheduleWakeUp(scheduler);
     }
 }
 
-void Layout::handleMouseMoved(sf::Vector2i mousePosition)
+std::size_t Layout::childCount() const
+{
+    return m_entries.size();
+}
+
+UiElement *Layout::child(std::size_t index) const
 {
-    mousePosition -= sf::Vector2i{getPosition()};
+    return m_entries[index].get();
+}
+
+sf::Vector2f Layout::onMeasure()
+{
+    auto length = 2 * m_padding + (std::max<std::size_t>(m_entries.size(), 1) - 1) * m_spacing;
+    auto thickness = 0.f;
     for (const auto &entry : m_entries) {
-        entry->handleMouseMoved(mousePosition);
+        const auto measured = entry->measure();
+        length += along(measured);
+        thickness = std::max(thickness, across(measured));
+    }
+    auto measured = orient(length, thickness + 2 * m_padding);
+    if (fillWidth()) {
+        measured.x = 0;
     }
+    if (fillHeight()) {
+        measured.y = 0;
+    }
+    return measured;
 }
 
-void Layout::recalculateSizes()
+void Layout::onArrange()
 {
-    const auto remainingSize = dimension(m_orientation) - 2 * m_padding
-                               - std::accumulate(
-                                   std::cbegin(m_entries),
-                                   std::cend(m_entries),
-                                   0.0f,
-                                   [this](auto sum, const auto &entry) { return sum + entry->dimension(m_orientation); })
-                               - (m_entries.size() - 1) * m_spacing;
-
-    const auto sizePerSpacer = remainingSize / std::ranges::count_if(m_entries, [this](const auto &entry) {
-                                   return entry->fillWidth() && m_orientation == Orientation::Horizontal
-                                          || entry->fillHeight() && m_orientation == Orientation::Vertical;
-                               });
+    auto fixedLength = 2 * m_padding + (std::max<std::size_t>(m_entries.size(), 1) - 1) * m_spacing;
+    auto totalFlex = 0.f;
     for (const auto &entry : m_entries) {
-        if (entry->fillWidth()) {
-            entry->setSize(
-                {m_orientation == Orientation::Horizontal ? sizePerSpacer : size().x - 2 * m_padding, entry->size().y});
-        } else if (entry->fillHeight()) {
-            entry->setSize(
-                {entry->size().x, m_orientation == Orientation::Vertical ? sizePerSpacer : size().y - 2 * m_padding});
+        if (fillsAxis(*entry)) {
+            totalFlex += entry->flex();
+        } else {
+            fixedLength += along(entry->measure());
         }
     }
-    auto originPosition = sf::Vector2f{m_padding, m_padding};
+    const auto remainingLength = std::max(along(size()) - fixedLength, 0.f);
+    const auto crossLength = std::max(across(size()) - 2 * m_padding, 0.f);
+    auto origin = m_padding;
     for (const auto &entry : m_entries) {
-        entry->setPosition(originPosition);
-        const auto newPosition = m_spacing + entry->dimension(m_orientation);
-        if (m_orientation == Orientation::Horizontal) {
-            originPosition.x += newPosition;
-        } else {
-            originPosition.y += newPosition;
-        };
+        const auto measured = entry->measure();
+        const auto length = fillsAxis(*entry) ? remainingLength * entry->flex() / totalFlex : along(measured);
+        const auto thickness = fillsCrossAxis(*entry) ? crossLength : across(measured);
+        entry->arrange(orient(origin, m_padding), orient(length, thickness));
+        origin += length + m_spacing;
     }
 }
+
+bool Layout::fillsAxis(const UiElement &entry) const
+{
+    return m_orientation == Orientation::Horizontal ? entry.fillWidth() : entry.fillHeight();
+}
+
+bool Layout::fillsCrossAxis(const UiElement &entry) const
+{
+    return m_orientation == Orientation::Horizontal ? entry.fillHeight() : entry.fillWidth();
+}
+
+float Layout::along(sf::Vector2f size) const
+{
+    return m_orientation == Orientation::Horizontal ? size.x : size.y;
+}
+
+float Layout::across(sf::Vector2f size) const
+{
+    return m_orientation == Orientation::Horizontal ? size.y : size.x;
+}
+
+sf::Vector2f Layout::orient(float length, float thickness) const
+{
+    return m_orientation == Orientation::Horizontal ? sf::Vector2f{length, thickness} : sf::Vector2f{thickness, length};
+}
@@ -1,12 +1,13 @@
 #pragma once
 
 #include "UiElement.hpp"
-#include <list>
+#include <memory_resource>
+#include <vector>
 
 class Layout : public UiElement
 {
 public:
-    explicit Layout(Orientation orientation);
+    explicit Layout(Orientation orientation, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
     void addEntry(std::unique_ptr<UiElement> &&entry);
 
@@ -21,16 +22,25 @@ public:
 
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
     void show() override;
-    void handleMousePressed(sf::Vector2i mousePosition) override;
-    void handleMouseReleased(sf::Vector2i mousePosition) override;
-    void handleMouseMoved(sf::Vector2i mousePosition) override;
+    void clearDirty() override;
+    bool animating() const override;
+    void scheduleWakeUp(Scheduler &scheduler) const override;
+
+    std::size_t childCount() const override;
+    UiElement *child(std::size_t index) const override;
 
 private:
-    void recalculateSizes();
+    sf::Vector2f onMeasure() override;
+    void onArrange() override;
+    bool fillsAxis(const UiElement &entry) const;
+    bool fillsCrossAxis(const UiElement &entry) const;
+    float along(sf::Vector2f size) const;
+    float across(sf::Vector2f size) const;
+    sf::Vector2f orient(float length, float thickness) const;
 
     sf::Vector2f m_size{};
     float m_spacing{};
     float m_padding{};
     Orientation m_orientation{};
-    std::list<std::unique_ptr<UiElement>> m_entries;
+    std::pmr::vector<std::unique_ptr<UiElement>> m_entries;
 };
\ No newline at end of file
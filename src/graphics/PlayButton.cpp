@@ -7,6 +7,7 @@ constexpr auto Padding = 2.f;
 constexpr auto LoadingCirclesCount = 10;
 constexpr auto DefaultSize = 20.f;
 constexpr auto CircleRadius = 2.f;
+constexpr auto LoadingFrameInterval = std::chrono::milliseconds{16};
 
 PlayButton::PlayButton(FilmController &controller)
     : m_controller{controller}
@@ -54,6 +55,8 @@ PlayButton::PlayButton(FilmController &controller)
     };
     for (const auto i : std::views::iota(0, LoadingCirclesCount))
         m_loadingShapes.push_back(createLoadingShape(i));
+
+    m_stateConnection = m_controller.onStateChanged([this] { markDirty(); });
 }
 
 void PlayButton::draw(sf::RenderTarget &target, sf::RenderStates states) const
@@ -77,6 +80,18 @@ void PlayButton::draw(sf::RenderTarget &target, sf::RenderStates states) const
     }
 }
 
+bool PlayButton::animating() const
+{
+    return m_controller.loading();
+}
+
+void PlayButton::scheduleWakeUp(Scheduler &scheduler) const
+{
+    if (m_controller.loading()) {
+        scheduler.wakeUpIn(LoadingFrameInterval);
+    }
+}
+
 void PlayButton::onPressed(sf::Vector2i mousePosition)
 {
     if (m_controller.playing()) {
@@ -9,6 +9,8 @@ public:
     explicit PlayButton(FilmController &controller);
 
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
+    bool animating() const override;
+    void scheduleWakeUp(Scheduler &scheduler) const override;
 
 private:
     void onPressed(sf::Vector2i mousePosition) override;
@@ -19,4 +21,5 @@ private:
     std::unique_ptr<sf::ConvexShape> m_playShape;
     std::unique_ptr<sf::RectangleShape> m_restartShape;
     sf::Clock m_clock;
+    ScopedConnection m_stateConnection;
 };
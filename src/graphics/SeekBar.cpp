@@ -1,11 +1,35 @@
 #include "SeekBar.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <utility>
 
 const auto DefaultSize = sf::Vector2f{0, 16};
 constexpr auto HandleRadius = 6.f;
 const auto HandleColor = sf::Color{240, 50, 50};
+const auto BufferedColor = sf::Color{220, 220, 220, 110};
+constexpr auto HandlePointCount = 20;
+constexpr auto HandleVertexCount = HandlePointCount * 3;
+constexpr auto TooltipOffset = 21.f;
+constexpr auto ZoomStep = 1.25f;
+constexpr auto PanStep = 0.1f;
+constexpr auto MinimumViewDuration = std::chrono::milliseconds{std::chrono::seconds{1}};
+
+namespace {
+void appendRect(std::vector<sf::Vertex> &vertices, float left, float right, const sf::FloatRect &track, sf::Color color)
+{
+    const auto top = track.top;
+    const auto bottom = track.top + track.height;
+    for (const auto corner :
+         {sf::Vector2f{left, top}, {right, top}, {left, bottom}, {left, bottom}, {right, top}, {right, bottom}}) {
+        vertices.emplace_back(corner, color);
+    }
+}
+} // namespace
 
 SeekBar::SeekBar(FilmController &controller)
     : m_controller{controller}
+    , m_filmDetails{m_controller.filmDetailsSnapshot()}
 {
     setSize(DefaultSize);
     setFillWidth(true);
@@ -15,54 +39,191 @@ SeekBar::SeekBar(FilmController &controller)
     m_handle.setPosition({-HandleRadius, size().y / 2 - HandleRadius});
 
     updateChapters();
-    m_controller.onCurrentTimeChanged([this] { setCurrentTime(m_controller.currentTime()); });
+    m_currentTimeConnection = m_controller.onCurrentTimeChanged(
+        [this](auto time) { return std::int64_t(std::floor(timeToPosition(time))); },
+        [this] { setCurrentTime(displayedTime()); });
+    m_stateConnection = m_controller.onStateChanged([this] { markDirty(); });
+    m_filmDetailsConnection = m_controller.onFilmDetailsChanged([this] {
+        updateChapters();
+        updateGeometry();
+    });
+    m_bufferedRangesConnection = m_controller.onBufferedRangesChanged([this] { updateBufferedVertices(); });
+}
+
+bool SeekBar::batched() const
+{
+    return m_batched;
+}
+
+void SeekBar::setBatched(bool batched)
+{
+    m_batched = batched;
+    updateVertices();
+}
+
+float SeekBar::minimumChapterWidth() const
+{
+    return m_minimumChapterWidth;
+}
+
+void SeekBar::setMinimumChapterWidth(float width)
+{
+    m_minimumChapterWidth = width;
+    updateSegments();
+    updateGeometry();
+}
+
+SeekScheduler *SeekBar::seekScheduler() const
+{
+    return m_seekScheduler;
+}
+
+void SeekBar::setSeekScheduler(SeekScheduler *seekScheduler)
+{
+    m_seekScheduler = seekScheduler;
+}
+
+std::chrono::milliseconds SeekBar::viewStart() const
+{
+    return m_viewStart;
+}
+
+std::chrono::milliseconds SeekBar::viewEnd() const
+{
+    return m_viewEnd;
+}
+
+void SeekBar::setView(std::chrono::milliseconds start, std::chrono::milliseconds end)
+{
+    const auto duration = m_filmDetails->duration;
+    const auto length = std::clamp(end - start, std::min(MinimumViewDuration, duration), duration);
+    m_viewStart = std::clamp(start, std::chrono::milliseconds{0}, duration - length);
+    m_viewEnd = m_viewStart + length;
+    updateSegments();
+    updateGeometry();
+}
+
+void SeekBar::zoom(float factor, std::chrono::milliseconds anchor)
+{
+    const auto length = std::chrono::milliseconds{std::int64_t((m_viewEnd - m_viewStart).count() / factor)};
+    const auto start = anchor - std::chrono::milliseconds{std::int64_t((anchor - m_viewStart).count() / factor)};
+    setView(start, start + length);
+}
+
+void SeekBar::pan(std::chrono::milliseconds offset)
+{
+    setView(m_viewStart + offset, m_viewEnd + offset);
+}
+
+const Label *SeekBar::tooltip() const
+{
+    return m_tooltip.get();
 }
 
 void SeekBar::draw(sf::RenderTarget &target, sf::RenderStates states) const
 {
     states.transform *= getTransform();
-    if (m_controller.loading()) {
+    if (!m_controller.seekable()) {
         return;
     }
-    for (const auto &shape : m_chapters) {
-        target.draw(*shape.get(), states);
+    const auto handleShown = m_handleVisible && (hovered() || pressed());
+    if (m_batched) {
+        const auto chapterVertexCount = m_chapters.size() * Chapter::VertexCount;
+        if (chapterVertexCount > 0) {
+            target.draw(&m_vertices[0], chapterVertexCount, sf::Triangles, states);
+        }
+    } else {
+        for (const auto &shape : m_chapters) {
+            target.draw(*shape.get(), states);
+        }
     }
-    if (hovered() || pressed()) {
+    if (!m_bufferedVertices.empty()) {
+        target.draw(m_bufferedVertices.data(), m_bufferedVertices.size(), sf::Triangles, states);
+    }
+    if (handleShown && m_batched) {
+        target.draw(&m_vertices[m_chapters.size() * Chapter::VertexCount], HandleVertexCount, sf::Triangles, states);
+    } else if (handleShown) {
         target.draw(m_handle, states);
     }
+    if (m_hoveredChapter && m_chapters[*m_hoveredChapter]->hovered()) {
+        target.draw(*m_tooltip, states);
+    }
 
     UiElement::draw(target, states);
 }
 void SeekBar::handleMouseMoved(sf::Vector2i mousePosition)
 {
-    if (m_controller.loading()) {
+    if (!m_controller.seekable()) {
         return;
     }
     UiElement::handleMouseMoved(mousePosition);
     mousePosition -= sf::Vector2i{getPosition()};
+    const auto chapter = chapterAtPosition(float(mousePosition.x));
+    const auto wasHovered = chapter && m_chapters[*chapter]->hovered();
+    const auto previousChapter = m_hoveredChapter;
+    if (m_hoveredChapter && m_hoveredChapter != chapter) {
+        m_chapters[*m_hoveredChapter]->handleMouseMoved(mousePosition);
+        updateChapterVertices(*m_hoveredChapter);
+    }
+    m_hoveredChapter = chapter;
+    if (chapter) {
+        m_chapters[*chapter]->handleMouseMoved(mousePosition);
+        updateChapterVertices(*chapter);
+    }
+    if (chapter != previousChapter || (chapter && m_chapters[*chapter]->hovered() != wasHovered)) {
+        updateBufferedVertices();
+    }
+    updateTooltip();
+}
+
+void SeekBar::clearDirty()
+{
+    UiElement::clearDirty();
     for (const auto &chapter : m_chapters) {
-        chapter->handleMouseMoved(mousePosition);
+        chapter->clearDirty();
     }
+    if (m_tooltip) {
+        m_tooltip->clearDirty();
+    }
+}
+
+void SeekBar::scheduleWakeUp(Scheduler &scheduler) const
+{
+    const auto currentTime = m_controller.currentTime();
+    if (!m_controller.playing() || size().x <= 0 || currentTime < m_viewStart || currentTime >= m_viewEnd) {
+        return;
+    }
+    const auto nextPixel = std::floor(timeToPosition(currentTime)) + 1;
+    const auto nextPixelTime = m_viewStart
+                               + std::chrono::milliseconds{
+                                   std::int64_t(std::ceil(nextPixel * (m_viewEnd - m_viewStart).count() / size().x))};
+    scheduler.wakeUpIn(std::max(nextPixelTime - currentTime, std::chrono::milliseconds{1}));
 }
 
 void SeekBar::updateGeometry()
 {
-    const auto availableSize = size().x - (m_chapters.size() - 1) * m_spacing;
-    for (auto x{0.f}; const auto &chapter : m_chapters) {
-        const auto ratio = float(chapter->details().duration().count()) / m_controller.filmDetails().duration.count();
-        chapter->setPosition(sf::Vector2f{x, (size().y - chapter->size().y) / 2});
-        chapter->setSize({ratio * availableSize, size().y});
-        x += chapter->size().x + m_spacing;
+    if (size().x != m_segmentsWidth) {
+        updateSegments();
     }
+    for (auto i = std::size_t{0}; i < m_chapters.size(); ++i) {
+        const auto &chapter = m_chapters[i];
+        const auto left = timeToPosition(m_chapterIndex.startTime(i));
+        const auto right = timeToPosition(m_chapterIndex.endTime(i));
+        const auto spacing = right < size().x ? m_spacing : 0;
+        chapter->setPosition(sf::Vector2f{left, (size().y - chapter->size().y) / 2});
+        chapter->setSize({std::max(right - left - spacing, 0.f), size().y});
+    }
+    updateVertices();
+    updateTooltip();
+    setCurrentTime(displayedTime());
 }
 
 void SeekBar::onPressed(sf::Vector2i mousePosition)
 {
-    if (m_controller.loading()) {
+    if (!m_controller.seekable()) {
         return;
     }
-    m_controller.jumpTo(std::chrono::duration_cast<std::chrono::milliseconds>(
-        m_controller.filmDetails().duration * (mousePosition.x - getPosition().x) / size().x));
+    seek(positionToTime(mousePosition.x - getPosition().x), SeekMode::Exact);
 }
 
 void SeekBar::onDragStarted()
@@ -74,6 +235,9 @@ void SeekBar::onDragStarted()
 
 void SeekBar::onDragFinished()
 {
+    if (const auto time = std::exchange(m_dragTime, std::nullopt)) {
+        seek(*time, SeekMode::Exact);
+    }
     if (m_wasPlaying) {
         m_controller.play();
     }
@@ -81,33 +245,231 @@ void SeekBar::onDragFinished()
 
 void SeekBar::onDragMove(sf::Vector2i mousePosition)
 {
-    onPressed(mousePosition);
+    if (!m_controller.seekable()) {
+        return;
+    }
+    const auto time = std::clamp(
+        positionToTime(mousePosition.x - getPosition().x), std::chrono::milliseconds{0}, m_filmDetails->duration);
+    if (time < m_viewStart) {
+        pan(time - m_viewStart);
+    } else if (time > m_viewEnd) {
+        pan(time - m_viewEnd);
+    }
+    m_dragTime = time;
+    seek(time, SeekMode::Fast);
+}
+
+void SeekBar::onMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta)
+{
+    if (!m_controller.seekable()) {
+        return;
+    }
+    if (wheel == sf::Mouse::VerticalWheel) {
+        zoom(std::pow(ZoomStep, delta), positionToTime(mousePosition.x - getPosition().x));
+    } else {
+        pan(std::chrono::milliseconds{std::int64_t(delta * PanStep * (m_viewEnd - m_viewStart).count())});
+    }
 }
 
 void SeekBar::updateChapters()
 {
-    const auto newSize = m_controller.filmDetails().chapters.size();
-    const auto oldSize = m_chapters.size();
-    if (newSize > m_controller.filmDetails().chapters.size()) {
-        m_chapters.erase(std::next(std::begin(m_chapters), newSize), std::end(m_chapters));
-    } else if (oldSize < newSize) {
-        std::generate_n(std::back_inserter(m_chapters), newSize - oldSize, [this, i = oldSize] mutable {
-            return std::make_unique<Chapter>(m_controller.filmDetails().chapters.at(i++));
-        });
+    m_filmDetails = m_controller.filmDetailsSnapshot();
+    m_levelOfDetail = ChapterLevelOfDetail{m_filmDetails->chapters};
+    m_viewStart = {};
+    m_viewEnd = m_filmDetails->duration;
+    updateSegments();
+}
+
+void SeekBar::updateSegments()
+{
+    const auto &chapters = m_filmDetails->chapters;
+    const auto segments = m_levelOfDetail.segments(size().x, m_viewStart, m_viewEnd, m_minimumChapterWidth);
+    m_segmentsWidth = size().x;
+    releaseSegments();
+    m_aggregatedChapters.reserve(std::ranges::count_if(segments, &ChapterLevelOfDetail::Segment::aggregated));
+    m_chapters.reserve(segments.size());
+    auto startTimes = std::vector<std::chrono::milliseconds>{};
+    auto endTimes = std::vector<std::chrono::milliseconds>{};
+    startTimes.reserve(segments.size());
+    endTimes.reserve(segments.size());
+    for (const auto &segment : segments) {
+        const auto *details = &chapters[segment.firstChapter];
+        if (segment.aggregated()) {
+            auto name = std::pmr::string{chapters[segment.firstChapter].name, m_arena.resource()};
+            name.append(" - ").append(chapters[segment.lastChapter].name);
+            details = &m_aggregatedChapters.emplace_back(FilmDetails::ChapterDetails{
+                .name = std::move(name), .startTime = segment.startTime, .endTime = segment.endTime});
+        }
+        auto chapter = m_arena.make<Chapter>(*details);
+        chapter->setParent(this);
+        m_chapters.push_back(std::move(chapter));
+        startTimes.push_back(std::max(segment.startTime, m_viewStart));
+        endTimes.push_back(std::min(segment.endTime, m_viewEnd));
+    }
+    m_chapterIndex = ChapterIndex{std::move(startTimes), std::move(endTimes)};
+    m_hoveredChapter.reset();
+    for (auto i = std::size_t{0}; i < m_chapters.size(); ++i) {
+        updateFill(i);
+    }
+    m_filledCount = m_chapterIndex.filledCount(m_currentTime);
+    updateVertices();
+    markDirty();
+}
+
+void SeekBar::releaseSegments()
+{
+    decltype(m_chapters){m_arena.resource()}.swap(m_chapters);
+    decltype(m_aggregatedChapters){m_arena.resource()}.swap(m_aggregatedChapters);
+    m_arena.reset();
+}
+
+void SeekBar::seek(std::chrono::milliseconds time, SeekMode mode)
+{
+    if (!m_seekScheduler) {
+        m_controller.jumpTo(time, mode);
+        return;
     }
+    m_seekScheduler->request(time, mode);
+    setCurrentTime(displayedTime());
+}
+
+// While seeks are pending the handle follows the latest request rather than the last completed seek.
+std::chrono::milliseconds SeekBar::displayedTime() const
+{
+    if (const auto target = m_seekScheduler ? m_seekScheduler->target() : std::nullopt) {
+        return std::clamp(*target, std::chrono::milliseconds{0}, m_filmDetails->duration);
+    }
+    return m_controller.currentTime();
 }
 
 void SeekBar::setCurrentTime(std::chrono::milliseconds currentTime)
 {
+    if (m_controller.playing() && currentTime >= m_viewEnd && m_viewEnd < m_filmDetails->duration) {
+        pan(currentTime - m_viewStart);
+        return;
+    }
     m_currentTime = currentTime;
-    for (const auto &chapter : m_chapters) {
-        chapter->setFilled(std::ranges::clamp(
-            (m_currentTime.count() - chapter->details().startTime.count())
-                / float(chapter->details().duration().count()),
-            0.0f,
-            1.0f));
-    }
-    m_handle.setPosition(
-        {size().x * m_controller.currentTime().count() / m_controller.filmDetails().duration.count() - HandleRadius,
-         size().y / 2 - HandleRadius});
-}
\ No newline at end of file
+    const auto filledCount = m_chapterIndex.filledCount(m_currentTime);
+    const auto [first, last] = std::minmax(m_filledCount, filledCount);
+    for (auto i = first; i <= last && i < m_chapters.size(); ++i) {
+        updateFill(i);
+        updateChapterVertices(i);
+    }
+    m_filledCount = filledCount;
+    const auto handleVisible = currentTime >= m_viewStart && currentTime <= m_viewEnd;
+    const auto handlePosition = sf::Vector2f{timeToPosition(currentTime) - HandleRadius, size().y / 2 - HandleRadius};
+    if (handlePosition != m_handle.getPosition() || handleVisible != m_handleVisible) {
+        m_handleVisible = handleVisible;
+        m_handle.setPosition(handlePosition);
+        updateHandleVertices();
+        updateBufferedVertices();
+        markDirty();
+    }
+}
+
+void SeekBar::updateFill(std::size_t index)
+{
+    const auto startTime = m_chapterIndex.startTime(index);
+    const auto endTime = m_chapterIndex.endTime(index);
+    m_chapters[index]->setFilled(
+        std::ranges::clamp((m_currentTime - startTime).count() / float((endTime - startTime).count()), 0.0f, 1.0f));
+}
+
+void SeekBar::updateVertices()
+{
+    if (!m_batched) {
+        m_vertices.clear();
+        return;
+    }
+    m_vertices.resize(m_chapters.size() * Chapter::VertexCount + HandleVertexCount);
+    for (auto i = std::size_t{0}; i < m_chapters.size(); ++i) {
+        updateChapterVertices(i);
+    }
+    updateHandleVertices();
+    updateBufferedVertices();
+}
+
+void SeekBar::updateChapterVertices(std::size_t index)
+{
+    if (m_batched) {
+        m_chapters[index]->writeVertices(&m_vertices[index * Chapter::VertexCount]);
+    }
+}
+
+void SeekBar::updateHandleVertices()
+{
+    if (!m_batched) {
+        return;
+    }
+    const auto center = m_handle.getPosition() + sf::Vector2f{HandleRadius, HandleRadius};
+    const auto pointAt = [&](int i) {
+        const auto angle = 2 * std::numbers::pi_v<float> * i / HandlePointCount;
+        return center + sf::Vector2f{HandleRadius * std::cos(angle), HandleRadius * std::sin(angle)};
+    };
+    auto *vertices = &m_vertices[m_chapters.size() * Chapter::VertexCount];
+    for (auto i = 0; i < HandlePointCount; ++i) {
+        *vertices++ = sf::Vertex{center, HandleColor};
+        *vertices++ = sf::Vertex{pointAt(i), HandleColor};
+        *vertices++ = sf::Vertex{pointAt(i + 1), HandleColor};
+    }
+}
+
+// Buffered ranges are drawn ahead of the current time only, so they never cover the filled part of the track.
+void SeekBar::updateBufferedVertices()
+{
+    m_bufferedVertices.clear();
+    const auto from = std::max(m_currentTime, m_viewStart);
+    m_controller.bufferedRanges().forEachOverlapping(from, m_viewEnd, [&](const auto &range) {
+        const auto start = timeToPosition(std::max(range.start, from));
+        const auto end = timeToPosition(std::min(range.end, m_viewEnd));
+        for (auto i = m_chapterIndex.filledCount(std::max(range.start, from));
+             i < m_chapters.size() && m_chapterIndex.startTime(i) < range.end;
+             ++i) {
+            const auto track = m_chapters[i]->trackRect();
+            const auto left = std::max(start, track.left);
+            const auto right = std::min(end, track.left + track.width);
+            if (right > left) {
+                appendRect(m_bufferedVertices, left, right, track, BufferedColor);
+            }
+        }
+    });
+    markDirty();
+}
+
+void SeekBar::updateTooltip()
+{
+    if (!m_hoveredChapter || !m_chapters[*m_hoveredChapter]->hovered()) {
+        return;
+    }
+    if (!m_tooltip) {
+        m_tooltip = std::make_unique<Label>();
+        m_tooltip->setParent(this);
+    }
+    const auto &chapter = *m_chapters[*m_hoveredChapter];
+    m_tooltip->setText(chapter.details().name);
+    const auto bounds = m_tooltip->getGlobalBounds();
+    m_tooltip->setPosition(
+        chapter.getPosition().x + chapter.size().x / 2 - bounds.width / 2,
+        size().y / 2 - bounds.height / 2 - TooltipOffset);
+}
+
+float SeekBar::timeToPosition(std::chrono::milliseconds time) const
+{
+    const auto length = (m_viewEnd - m_viewStart).count();
+    return length == 0 ? 0.f : size().x * (time - m_viewStart).count() / length;
+}
+
+std::chrono::milliseconds SeekBar::positionToTime(float x) const
+{
+    return m_viewStart + std::chrono::milliseconds{std::int64_t((m_viewEnd - m_viewStart).count() * x / size().x)};
+}
+
+std::optional<std::size_t> SeekBar::chapterAtPosition(float x) const
+{
+    const auto it = std::ranges::upper_bound(
+        m_chapters, x, {}, [](const auto &chapter) { return chapter->getPosition().x; });
+    if (it == std::cbegin(m_chapters)) {
+        return std::nullopt;
+    }
+    return std::size_t(std::distance(std::cbegin(m_chapters), it) - 1);
+}
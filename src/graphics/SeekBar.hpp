@@ -1,17 +1,43 @@
 #pragma once
 
+#include "Arena.hpp"
 #include "Chapter.hpp"
+#include "ChapterIndex.hpp"
+#include "ChapterLevelOfDetail.hpp"
 #include "FilmController.hpp"
+#include "Label.hpp"
+#include "SeekScheduler.hpp"
 #include "UiElement.hpp"
-#include <list>
+#include <optional>
+#include <vector>
 
 class SeekBar : public UiElement
 {
 public:
     explicit SeekBar(FilmController &controller);
 
+    bool batched() const;
+    void setBatched(bool batched);
+
+    float minimumChapterWidth() const;
+    void setMinimumChapterWidth(float width);
+
+    SeekScheduler *seekScheduler() const;
+    void setSeekScheduler(SeekScheduler *seekScheduler);
+
+    std::chrono::milliseconds viewStart() const;
+    std::chrono::milliseconds viewEnd() const;
+    void setView(std::chrono::milliseconds start, std::chrono::milliseconds end);
+    void zoom(float factor, std::chrono::milliseconds anchor);
+    void pan(std::chrono::milliseconds offset);
+
+    // The one label shared by all chapters, created when a chapter is first hovered.
+    const Label *tooltip() const;
+
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
     void handleMouseMoved(sf::Vector2i mousePosition) override;
+    void clearDirty() override;
+    void scheduleWakeUp(Scheduler &scheduler) const override;
 
 private:
     void updateGeometry() override;
@@ -19,14 +45,50 @@ private:
     void onDragStarted() override;
     void onDragFinished() override;
     void onDragMove(sf::Vector2i mousePosition) override;
+    void onMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta) override;
 
+    void seek(std::chrono::milliseconds time, SeekMode mode);
+    std::chrono::milliseconds displayedTime() const;
     void setCurrentTime(std::chrono::milliseconds currentTime);
     void updateChapters();
+    void updateSegments();
+    void releaseSegments();
+    void updateFill(std::size_t index);
+    void updateVertices();
+    void updateChapterVertices(std::size_t index);
+    void updateHandleVertices();
+    void updateBufferedVertices();
+    void updateTooltip();
+    float timeToPosition(std::chrono::milliseconds time) const;
+    std::chrono::milliseconds positionToTime(float x) const;
+    std::optional<std::size_t> chapterAtPosition(float x) const;
 
     FilmController &m_controller;
-    std::chrono::milliseconds m_currentTime;
-    std::list<std::unique_ptr<Chapter>> m_chapters;
+    SeekScheduler *m_seekScheduler{};
+    std::shared_ptr<const FilmDetails> m_filmDetails;
+    std::chrono::milliseconds m_viewStart{};
+    std::chrono::milliseconds m_viewEnd{};
+    std::chrono::milliseconds m_currentTime{};
+    ChapterLevelOfDetail m_levelOfDetail;
+    float m_segmentsWidth{-1};
+    float m_minimumChapterWidth{4};
+    Arena m_arena;
+    std::pmr::vector<FilmDetails::ChapterDetails> m_aggregatedChapters{m_arena.resource()};
+    std::pmr::vector<Arena::Pointer<Chapter>> m_chapters{m_arena.resource()};
+    ChapterIndex m_chapterIndex;
+    std::size_t m_filledCount{};
+    std::optional<std::size_t> m_hoveredChapter;
+    std::unique_ptr<Label> m_tooltip;
     sf::CircleShape m_handle;
+    bool m_handleVisible{};
+    sf::VertexArray m_vertices{sf::Triangles};
+    std::vector<sf::Vertex> m_bufferedVertices;
+    bool m_batched{true};
+    ScopedConnection m_currentTimeConnection;
+    ScopedConnection m_stateConnection;
+    ScopedConnection m_filmDetailsConnection;
+    ScopedConnection m_bufferedRangesConnection;
     bool m_wasPlaying{};
+    std::optional<std::chrono::milliseconds> m_dragTime;
     int m_spacing{2};
 };
\ No newline at end of file
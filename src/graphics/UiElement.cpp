@@ -9,6 +9,8 @@ void UiElement::setSize(sf::Vector2f size)
 {
     m_size = size;
     updateGeometry();
+    markDirty();
+    invalidateLayout();
 }
 
 const std::unique_ptr<sf::Shape> &UiElement::shape() const
@@ -19,6 +21,7 @@ const std::unique_ptr<sf::Shape> &UiElement::shape() const
 void UiElement::setShape(std::unique_ptr<sf::Shape> &&shape)
 {
     m_shape = std::move(shape);
+    markDirty();
 }
 
 float UiElement::dimension(Orientation orientation) const
@@ -39,6 +42,7 @@ bool UiElement::fillWidth() const
 void UiElement::setFillWidth(bool fillWidth)
 {
     m_fillWidth = fillWidth;
+    invalidateLayout();
 }
 
 bool UiElement::fillHeight() const
@@ -49,6 +53,72 @@ bool UiElement::fillHeight() const
 void UiElement::setFillHeight(bool fillHeight)
 {
     m_fillHeight = fillHeight;
+    invalidateLayout();
+}
+
+float UiElement::flex() const
+{
+    return m_flex;
+}
+
+void UiElement::setFlex(float flex)
+{
+    m_flex = flex;
+    invalidateLayout();
+}
+
+sf::Vector2f UiElement::measure()
+{
+    if (!m_measureValid) {
+        m_measuredSize = onMeasure();
+        m_measureValid = true;
+    }
+    return m_measuredSize;
+}
+
+void UiElement::arrange(sf::Vector2f position, sf::Vector2f size)
+{
+    if (position != getPosition()) {
+        setPosition(position);
+        markDirty();
+    }
+    if (size != m_size) {
+        m_size = size;
+        m_layoutValid = false;
+        updateGeometry();
+        markDirty();
+    }
+    updateLayout();
+}
+
+void UiElement::updateLayout()
+{
+    if (!m_layoutValid) {
+        onArrange();
+        m_layoutValid = true;
+    }
+}
+
+bool UiElement::layoutValid() const
+{
+    return m_layoutValid;
+}
+
+void UiElement::invalidateLayout()
+{
+    if (!m_measureValid && !m_layoutValid) {
+        return;
+    }
+    m_measureValid = false;
+    m_layoutValid = false;
+    if (m_parent) {
+        m_parent->invalidateLayout();
+    }
+}
+
+sf::Vector2f UiElement::onMeasure()
+{
+    return {m_fillWidth ? 0 : m_size.x, m_fillHeight ? 0 : m_size.y};
 }
 
 void UiElement::draw(sf::RenderTarget &target, sf::RenderStates states) const
@@ -64,10 +134,49 @@ void UiElement::show()
     updateGeometry();
 }
 
+UiElement *UiElement::parent() const
+{
+    return m_parent;
+}
+
+void UiElement::setParent(UiElement *parent)
+{
+    m_parent = parent;
+    if (m_dirty && m_parent) {
+        m_parent->markDirty();
+    }
+}
+
+bool UiElement::dirty() const
+{
+    return m_dirty;
+}
+
+void UiElement::markDirty()
+{
+    m_dirty = true;
+    if (m_parent && !m_parent->dirty()) {
+        m_parent->markDirty();
+    }
+}
+
+void UiElement::clearDirty()
+{
+    m_dirty = false;
+}
+
+bool UiElement::animating() const
+{
+    return false;
+}
+
+void UiElement::scheduleWakeUp(Scheduler &) const {}
+
 void UiElement::handleMousePressed(sf::Vector2i mousePosition)
 {
     if (containsMouse(mousePosition)) {
         m_pressed = true;
+        markDirty();
         onPressed(mousePosition);
     }
 }
@@ -76,6 +185,7 @@ void UiElement::handleMouseReleased(sf::Vector2i mousePosition)
 {
     if (m_pressed) {
         m_pressed = false;
+        markDirty();
         onReleased();
         if (m_dragged) {
             m_dragged = false;
@@ -88,6 +198,7 @@ void UiElement::handleMouseMoved(sf::Vector2i mousePosition)
 {
     if (const auto hovered = containsMouse(mousePosition); hovered != m_hovered) {
         m_hovered = hovered;
+        markDirty();
         onHoveredChanged();
     }
     if (m_pressed) {
@@ -99,6 +210,23 @@ void UiElement::handleMouseMoved(sf::Vector2i mousePosition)
     }
 }
 
+void UiElement::handleMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta)
+{
+    if (containsMouse(mousePosition)) {
+        onMouseWheelScrolled(mousePosition, wheel, delta);
+    }
+}
+
+std::size_t UiElement::childCount() const
+{
+    return 0;
+}
+
+UiElement *UiElement::child(std::size_t index) const
+{
+    return nullptr;
+}
+
 bool UiElement::pressed() const
 {
     return m_pressed;
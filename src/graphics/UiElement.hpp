@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Scheduler.hpp"
 #include "Types.hpp"
 #include <SFML/Graphics.hpp>
 #include <memory>
@@ -24,35 +25,66 @@ public:
     bool fillHeight() const;
     void setFillHeight(bool fillHeight);
 
+    float flex() const;
+    void setFlex(float flex);
+
+    sf::Vector2f measure();
+    void arrange(sf::Vector2f position, sf::Vector2f size);
+    void updateLayout();
+    bool layoutValid() const;
+    void invalidateLayout();
+
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
 
     virtual void show();
 
+    UiElement *parent() const;
+    void setParent(UiElement *parent);
+
+    bool dirty() const;
+    void markDirty();
+    virtual void clearDirty();
+    virtual bool animating() const;
+    virtual void scheduleWakeUp(Scheduler &scheduler) const;
+
     virtual void handleMousePressed(sf::Vector2i mousePosition);
     virtual void handleMouseReleased(sf::Vector2i mousePosition);
     virtual void handleMouseMoved(sf::Vector2i mousePosition);
+    virtual void handleMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta);
+
+    virtual std::size_t childCount() const;
+    virtual UiElement *child(std::size_t index) const;
 
     bool pressed() const;
     bool hovered() const;
     bool dragged() const;
+    bool containsMouse(sf::Vector2i mousePosition) const;
 
 protected:
     sf::FloatRect rect() const;
-    bool containsMouse(sf::Vector2i mousePosition) const;
 
 private:
     virtual void updateGeometry(){};
+    virtual sf::Vector2f onMeasure();
+    virtual void onArrange() {}
     virtual void onPressed(sf::Vector2i mousePosition) {}
     virtual void onReleased() {}
     virtual void onHoveredChanged() {}
     virtual void onDragStarted() {}
     virtual void onDragFinished() {}
     virtual void onDragMove(sf::Vector2i mousePosition) {}
+    virtual void onMouseWheelScrolled(sf::Vector2i mousePosition, sf::Mouse::Wheel wheel, float delta) {}
 
     sf::Vector2f m_size{};
     std::unique_ptr<sf::Shape> m_shape;
+    UiElement *m_parent{};
+    bool m_dirty{true};
     bool m_fillWidth{};
     bool m_fillHeight{};
+    float m_flex{1};
+    sf::Vector2f m_measuredSize{};
+    bool m_measureValid{};
+    bool m_layoutValid{};
     bool m_pressed{};
     bool m_hovered{};
     bool m_dragged{};
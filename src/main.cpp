@@ -1,18 +1,95 @@
 
 #include "Application.hpp"
+#include "ChapterFile.hpp"
+#include "TimelineFile.hpp"
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
 
-int main()
+// There is no media behind the demo film, so assume a keyframe every two seconds.
+constexpr auto KeyframeInterval = std::chrono::seconds{2};
+
+namespace {
+std::shared_ptr<FilmDetails> createDemoFilm()
+{
+    auto details = FilmDetails::allocateShared(1024);
+    const auto allocator = details->chapters.get_allocator();
+    const auto addChapter = [&](std::string_view name, std::chrono::seconds startTime, std::chrono::seconds endTime) {
+        details->chapters.push_back(
+            {.name = std::pmr::string{name, allocator}, .startTime = startTime, .endTime = endTime});
+    };
+    details->name = "test";
+    details->duration = std::chrono::seconds{100};
+    addChapter("Intro", std::chrono::seconds{0}, std::chrono::seconds{10});
+    addChapter("Explanation", std::chrono::seconds{10}, std::chrono::seconds{70});
+    addChapter("Summary", std::chrono::seconds{70}, std::chrono::seconds{85});
+    addChapter("Goodbye", std::chrono::seconds{85}, std::chrono::seconds{100});
+    return details;
+}
+
+// Printed on exit with --stats.
+void printStats(const Application &app, const FilmController &filmController)
+{
+    std::cout << "Time to first frame: " << app.frameStats().timeToFirstFrame.asMilliseconds() << " ms\n";
+    std::cout << "Input events: " << app.inputStats().rawEvents << " received, " << app.inputStats().deliveredEvents
+              << " delivered\n";
+    if (const auto &seekStats = app.seekStats(); seekStats.completed > 0) {
+        std::cout << "Seeks: " << seekStats.requested << " requested, " << seekStats.issued
+                  << " issued, average latency "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(seekStats.totalLatency / seekStats.completed)
+                  << ", maximum "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(seekStats.maximumLatency) << '\n';
+    }
+    const auto bufferingStats = filmController.bufferingStats();
+    if (bufferingStats.startupLatency) {
+        std::cout << "Startup latency: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(*bufferingStats.startupLatency) << '\n';
+    }
+    std::cout << "Stalls: " << bufferingStats.stallCount << ", "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(bufferingStats.stallDuration) << " in total\n";
+}
+} // namespace
+
+int main(int argc, char *argv[])
 {
-    FilmController filmController{
-        {.name = "test",
-         .duration = std::chrono::seconds{100},
-         .chapters
-         = {{.name = "Intro", .startTime = std::chrono::seconds{0}, .endTime = std::chrono::seconds{10}},
-            {.name = "Explanation", .startTime = std::chrono::seconds{10}, .endTime = std::chrono::seconds{70}},
-            {.name = "Summary", .startTime = std::chrono::seconds{70}, .endTime = std::chrono::seconds{85}},
-            {.name = "Goodbye", .startTime = std::chrono::seconds{85}, .endTime = std::chrono::seconds{100}}}}};
+    auto stats = false;
+    auto path = std::optional<std::filesystem::path>{};
+    for (const auto *argument : std::span{argv + 1, std::size_t(argc - 1)}) {
+        if (std::string_view{argument} == "--stats") {
+            stats = true;
+        } else {
+            path = argument;
+        }
+    }
+    auto details = std::shared_ptr<FilmDetails>{};
+    if (path) {
+        if (path->extension() == ".timeline") {
+            const auto timeline = TimelineFile::load(*path);
+            if (!timeline) {
+                std::cerr << path->string() << ": " << timeline.error().describe() << '\n';
+                return 1;
+            }
+            details = timeline->sharedFilmDetails();
+        } else {
+            const auto chapterFile = ChapterFile::load(*path);
+            if (!chapterFile) {
+                std::cerr << path->string() << ": " << chapterFile.error().describe() << '\n';
+                return 1;
+            }
+            details = chapterFile->sharedFilmDetails(path->stem().string());
+        }
+    } else {
+        details = createDemoFilm();
+    }
+    details->keyframes
+        = KeyframeIndex::uniform(KeyframeInterval, details->duration, details->keyframes.get_allocator());
 
+    FilmController filmController{std::move(details)};
     Application app{filmController};
     app.run();
+    if (stats) {
+        printStats(app, filmController);
+    }
     return 0;
 }
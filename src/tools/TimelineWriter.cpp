@@ -0,0 +1,25 @@
+#include "ChapterFile.hpp"
+#include "TimelineFile.hpp"
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3 || argc > 4) {
+        std::cerr << "usage: " << argv[0] << " <chapters.vtt|.json|.csv> <output.timeline> [film name]\n";
+        return 2;
+    }
+    const auto input = std::filesystem::path{argv[1]};
+    const auto output = std::filesystem::path{argv[2]};
+    const auto chapterFile = ChapterFile::load(input);
+    if (!chapterFile) {
+        std::cerr << input.string() << ": " << chapterFile.error().describe() << '\n';
+        return 1;
+    }
+    const auto details = chapterFile->filmDetails(argc > 3 ? argv[3] : input.stem().string());
+    if (const auto written = TimelineFile::write(output, details); !written) {
+        std::cerr << output.string() << ": " << written.error().describe() << '\n';
+        return 1;
+    }
+    std::cout << "Wrote " << details.chapters.size() << " chapters to " << output.string() << '\n';
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+AllocationStats stats;
+}
+
+const AllocationStats &allocationStats()
+{
+    return stats;
+}
+
+void *operator new(std::size_t size)
+{
+    ++stats.allocations;
+    stats.bytes += size;
+    if (auto *pointer = std::malloc(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++stats.allocations;
+    stats.bytes += size;
+    const auto align = std::size_t(alignment);
+    if (auto *pointer = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
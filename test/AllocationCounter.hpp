@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+// Linking AllocationCounter.cpp replaces the global operator new and delete, including the aligned overloads that
+// std::pmr::new_delete_resource allocates through, with ones that keep these totals.
+struct AllocationStats
+{
+    std::size_t allocations{};
+    std::size_t bytes{};
+};
+
+const AllocationStats &allocationStats();
@@ -0,0 +1,81 @@
+#include "Arena.hpp"
+#include "FilmDetails.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+struct Tracked
+{
+    explicit Tracked(int &destroyed)
+        : destroyed{destroyed}
+    {}
+    ~Tracked() { ++destroyed; }
+
+    int &destroyed;
+};
+} // namespace
+
+TEST(Arena, makeRunsDestructor)
+{
+    auto arena = Arena{};
+    auto destroyed = 0;
+    {
+        const auto first = arena.make<Tracked>(destroyed);
+        const auto second = arena.make<Tracked>(destroyed);
+        ASSERT_NE(first.get(), second.get());
+    }
+    ASSERT_EQ(destroyed, 2);
+    arena.reset();
+}
+
+TEST(Arena, containersUseArena)
+{
+    auto arena = Arena{};
+    auto values = std::pmr::vector<int>{arena.resource()};
+    values.push_back(1);
+    ASSERT_EQ(values.get_allocator().resource(), arena.resource());
+}
+
+TEST(FilmDetails, makeSharedCopiesIntoArena)
+{
+    const auto details = FilmDetails{
+        .name = "Film",
+        .duration = std::chrono::seconds{20},
+        .chapters = {
+            {.name = "A chapter name longer than the small string buffer",
+             .startTime = std::chrono::seconds{0},
+             .endTime = std::chrono::seconds{10}},
+            {.name = "Second", .startTime = std::chrono::seconds{10}, .endTime = std::chrono::seconds{20}}}};
+    const auto shared = FilmDetails::makeShared(details);
+    ASSERT_EQ(shared->name, details.name);
+    ASSERT_EQ(shared->duration, details.duration);
+    ASSERT_EQ(shared->chapters.size(), 2);
+    ASSERT_EQ(shared->chapters[0].name, details.chapters[0].name);
+    ASSERT_EQ(shared->chapters[1].endTime, details.chapters[1].endTime);
+
+    const auto *resource = shared->chapters.get_allocator().resource();
+    ASSERT_NE(resource, std::pmr::get_default_resource());
+    ASSERT_EQ(shared->name.get_allocator().resource(), resource);
+    ASSERT_EQ(shared->chapters[0].name.get_allocator().resource(), resource);
+}
+
+TEST(FilmDetails, makeSharedCopiesKeyframesIntoArena)
+{
+    auto details = FilmDetails{.name = "Film", .duration = std::chrono::seconds{600}};
+    details.keyframes = KeyframeIndex::uniform(std::chrono::seconds{2}, details.duration);
+    const auto shared = FilmDetails::makeShared(details);
+    ASSERT_EQ(shared->keyframes.size(), details.keyframes.size());
+    ASSERT_EQ(shared->keyframes.nearest(std::chrono::milliseconds{301'600}), std::chrono::seconds{302});
+    ASSERT_EQ(shared->keyframes.get_allocator().resource(), shared->chapters.get_allocator().resource());
+}
+
+TEST(FilmDetails, allocateSharedFillsInPlace)
+{
+    const auto details = FilmDetails::allocateShared(256);
+    const auto *resource = details->chapters.get_allocator().resource();
+    ASSERT_NE(resource, std::pmr::get_default_resource());
+    ASSERT_EQ(details->name.get_allocator().resource(), resource);
+    ASSERT_EQ(details->keyframes.get_allocator().resource(), resource);
+
+    details->name = "A film name longer than the small string buffer";
+    ASSERT_EQ(details->name.get_allocator().resource(), resource);
+}
@@ -0,0 +1,225 @@
+#include "ChapterFile.hpp"
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(ChapterFile, parseTimestamp)
+{
+    ASSERT_EQ(ChapterFile::parseTimestamp("00:00:01.500"), 1500ms);
+    ASSERT_EQ(ChapterFile::parseTimestamp("01:02:03.004"), 1h + 2min + 3s + 4ms);
+    ASSERT_EQ(ChapterFile::parseTimestamp("02:03.1"), 2min + 3s + 100ms);
+    ASSERT_EQ(ChapterFile::parseTimestamp("125"), 125s);
+    ASSERT_EQ(ChapterFile::parseTimestamp("12.25"), 12250ms);
+    ASSERT_EQ(ChapterFile::parseTimestamp("00:60.000"), std::nullopt);
+    ASSERT_EQ(ChapterFile::parseTimestamp("01:60:00.000"), std::nullopt);
+    ASSERT_EQ(ChapterFile::parseTimestamp("1:2:3:4"), std::nullopt);
+    ASSERT_EQ(ChapterFile::parseTimestamp("12."), std::nullopt);
+    ASSERT_EQ(ChapterFile::parseTimestamp("12s"), std::nullopt);
+    ASSERT_EQ(ChapterFile::parseTimestamp(""), std::nullopt);
+}
+
+TEST(ChapterFile, parseWebVtt)
+{
+    const auto chapters = ChapterFile::parse(
+        "\xEF\xBB\xBFWEBVTT - chapters\r\n"
+        "Kind: chapters\r\n"
+        "\r\n"
+        "NOTE written by hand\r\n"
+        "\r\n"
+        "intro\r\n"
+        "00:00.000 --> 00:10.000\r\n"
+        "Intro\r\n"
+        "\r\n"
+        "00:00:10.000 --> 00:01:10.000 align:start\r\n"
+        "Explanation\r\n"
+        "second payload line\r\n",
+        ChapterFile::Format::WebVtt);
+    ASSERT_TRUE(chapters) << chapters.error().describe();
+    ASSERT_EQ(chapters->size(), 2);
+    ASSERT_EQ((*chapters)[0].name, "Intro");
+    ASSERT_EQ((*chapters)[0].endTime, 10s);
+    ASSERT_EQ((*chapters)[1].name, "Explanation");
+    ASSERT_EQ((*chapters)[1].startTime, 10s);
+    ASSERT_EQ((*chapters)[1].endTime, 70s);
+}
+
+TEST(ChapterFile, parseCsv)
+{
+    const auto chapters = ChapterFile::parse(
+        "start,end,name\n"
+        "0,10,Intro\n"
+        "\n"
+        "00:10,01:10.5, \"Explanation, part one\"\n",
+        ChapterFile::Format::Csv);
+    ASSERT_TRUE(chapters) << chapters.error().describe();
+    ASSERT_EQ(chapters->size(), 2);
+    ASSERT_EQ((*chapters)[0].name, "Intro");
+    ASSERT_EQ((*chapters)[1].name, "Explanation, part one");
+    ASSERT_EQ((*chapters)[1].endTime, 70500ms);
+}
+
+TEST(ChapterFile, parseJson)
+{
+    const auto chapters = ChapterFile::parse(
+        R"({"title": "Film", "tags": ["a", {"b": [1, 2]}],
+            "chapters": [
+                {"start": 0, "end": 10.5, "name": "Intro"},
+                {"name": "Explanation", "start": "00:00:10.500", "end": "00:01:10.000", "extra": null}
+            ]})",
+        ChapterFile::Format::Json);
+    ASSERT_TRUE(chapters) << chapters.error().describe();
+    ASSERT_EQ(chapters->size(), 2);
+    ASSERT_EQ((*chapters)[0].name, "Intro");
+    ASSERT_EQ((*chapters)[0].endTime, 10500ms);
+    ASSERT_EQ((*chapters)[1].name, "Explanation");
+    ASSERT_EQ((*chapters)[1].endTime, 70s);
+
+    const auto array = ChapterFile::parse(R"([{"start": 1, "end": 2, "title": "Only"}])", ChapterFile::Format::Json);
+    ASSERT_TRUE(array);
+    ASSERT_EQ((*array)[0].name, "Only");
+}
+
+TEST(ChapterFile, overlappingChapters)
+{
+    const auto chapters = ChapterFile::parse(
+        "WEBVTT\n"
+        "\n"
+        "00:00.000 --> 00:10.000\n"
+        "Intro\n"
+        "\n"
+        "00:09.000 --> 00:20.000\n"
+        "Overlap\n",
+        ChapterFile::Format::WebVtt);
+    ASSERT_FALSE(chapters);
+    ASSERT_EQ(chapters.error().code, ChapterFile::Error::Code::Overlapping);
+    ASSERT_EQ(chapters.error().line, 6);
+    ASSERT_EQ(
+        chapters.error().describe(),
+        "line 6: chapter \"Overlap\" starts at 00:00:09.000, before the previous chapter \"Intro\" ends at "
+        "00:00:10.000");
+}
+
+TEST(ChapterFile, unsortedChapters)
+{
+    const auto chapters = ChapterFile::parse("10,20,Second\n0,10,First\n", ChapterFile::Format::Csv);
+    ASSERT_FALSE(chapters);
+    ASSERT_EQ(chapters.error().code, ChapterFile::Error::Code::Unsorted);
+    ASSERT_EQ(chapters.error().line, 2);
+    ASSERT_EQ(
+        chapters.error().describe(),
+        "line 2: chapter \"First\" starts at 00:00:00.000, before the previous chapter \"Second\" starts at "
+        "00:00:10.000");
+}
+
+TEST(ChapterFile, emptyFile)
+{
+    for (const auto &[text, format] : {
+             std::pair{"WEBVTT\n\nNOTE nothing here\n", ChapterFile::Format::WebVtt},
+             std::pair{"start,end,name\n", ChapterFile::Format::Csv},
+             std::pair{R"({"chapters": []})", ChapterFile::Format::Json},
+             std::pair{"", ChapterFile::Format::Csv}}) {
+        const auto chapters = ChapterFile::parse(text, format);
+        ASSERT_FALSE(chapters) << text;
+        ASSERT_EQ(chapters.error().code, ChapterFile::Error::Code::Empty) << text;
+    }
+}
+
+TEST(ChapterFile, trailingJsonContent)
+{
+    const auto trailing = ChapterFile::parse("[{\"start\": 0, \"end\": 1}]\n]", ChapterFile::Format::Json);
+    ASSERT_FALSE(trailing);
+    ASSERT_EQ(trailing.error().code, ChapterFile::Error::Code::Malformed);
+    ASSERT_EQ(trailing.error().line, 2);
+
+    const auto trailingObject = ChapterFile::parse(
+        "{\"chapters\": [{\"start\": 0, \"end\": 1}]} garbage", ChapterFile::Format::Json);
+    ASSERT_FALSE(trailingObject);
+    ASSERT_EQ(trailingObject.error().code, ChapterFile::Error::Code::Malformed);
+
+    ASSERT_TRUE(ChapterFile::parse("[{\"start\": 0, \"end\": 1}]\n\n", ChapterFile::Format::Json));
+}
+
+TEST(ChapterFile, malformedInput)
+{
+    const auto missingHeader = ChapterFile::parse("00:00.000 --> 00:10.000\nIntro\n", ChapterFile::Format::WebVtt);
+    ASSERT_FALSE(missingHeader);
+    ASSERT_EQ(missingHeader.error().code, ChapterFile::Error::Code::Malformed);
+    ASSERT_EQ(missingHeader.error().line, 1);
+
+    const auto reversed = ChapterFile::parse("0,10,Intro\n20,15,Backwards\n", ChapterFile::Format::Csv);
+    ASSERT_FALSE(reversed);
+    ASSERT_EQ(reversed.error().code, ChapterFile::Error::Code::InvalidRange);
+    ASSERT_EQ(reversed.error().line, 2);
+
+    const auto badTimestamp = ChapterFile::parse("0,10,Intro\n10,1:75,Bad\n", ChapterFile::Format::Csv);
+    ASSERT_FALSE(badTimestamp);
+    ASSERT_EQ(badTimestamp.error().line, 2);
+
+    const auto unterminated =
+        ChapterFile::parse("[{\"start\": 0,\n\"end\": 1, \"name\": \"Intro}]", ChapterFile::Format::Json);
+    ASSERT_FALSE(unterminated);
+    ASSERT_EQ(unterminated.error().code, ChapterFile::Error::Code::Malformed);
+    ASSERT_EQ(unterminated.error().line, 2);
+
+    const auto missingEnd = ChapterFile::parse("[{\"start\": 0, \"name\": \"Intro\"}]", ChapterFile::Format::Json);
+    ASSERT_FALSE(missingEnd);
+}
+
+TEST(ChapterFile, loadMappedFile)
+{
+    const auto path = std::filesystem::temp_directory_path() / "seekbar_chapters_unittest.vtt";
+    {
+        auto stream = std::ofstream{path};
+        stream << "WEBVTT\n\n00:00.000 --> 00:10.000\nIntro\n\n00:10.000 --> 01:40.000\nRest\n";
+    }
+    const auto chapterFile = ChapterFile::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(chapterFile) << chapterFile.error().describe();
+    ASSERT_EQ(chapterFile->chapters().size(), 2);
+    ASSERT_EQ(chapterFile->duration(), 100s);
+
+    const auto details = chapterFile->filmDetails("Film");
+    ASSERT_EQ(details.name, "Film");
+    ASSERT_EQ(details.duration, 100s);
+    ASSERT_EQ(details.chapters[1].name, "Rest");
+}
+
+TEST(ChapterFile, sharedFilmDetailsUsesOneArena)
+{
+    const auto path = std::filesystem::temp_directory_path() / "seekbar_chapters_shared_unittest.vtt";
+    {
+        auto stream = std::ofstream{path};
+        stream << "WEBVTT\n\n00:00.000 --> 00:10.000\nA chapter name longer than the small string buffer\n";
+    }
+    const auto chapterFile = ChapterFile::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(chapterFile) << chapterFile.error().describe();
+
+    const auto details = chapterFile->sharedFilmDetails("Film");
+    ASSERT_EQ(details->name, "Film");
+    ASSERT_EQ(details->duration, 10s);
+    ASSERT_EQ(details->chapters[0].name, "A chapter name longer than the small string buffer");
+
+    const auto *resource = details->chapters.get_allocator().resource();
+    ASSERT_NE(resource, std::pmr::get_default_resource());
+    ASSERT_EQ(details->name.get_allocator().resource(), resource);
+    ASSERT_EQ(details->chapters[0].name.get_allocator().resource(), resource);
+}
+
+TEST(ChapterFile, loadMissingFile)
+{
+    const auto chapterFile = ChapterFile::load("/nonexistent/chapters.vtt");
+    ASSERT_FALSE(chapterFile);
+    ASSERT_EQ(chapterFile.error().code, ChapterFile::Error::Code::OpenFailed);
+}
+
+TEST(ChapterFile, detectFormat)
+{
+    ASSERT_EQ(ChapterFile::detectFormat("a.vtt", ""), ChapterFile::Format::WebVtt);
+    ASSERT_EQ(ChapterFile::detectFormat("a.json", ""), ChapterFile::Format::Json);
+    ASSERT_EQ(ChapterFile::detectFormat("a.csv", ""), ChapterFile::Format::Csv);
+    ASSERT_EQ(ChapterFile::detectFormat("a.txt", "WEBVTT\n"), ChapterFile::Format::WebVtt);
+    ASSERT_EQ(ChapterFile::detectFormat("a.txt", "  [{}]"), ChapterFile::Format::Json);
+    ASSERT_EQ(ChapterFile::detectFormat("a.txt", "0,1,a"), ChapterFile::Format::Csv);
+}
@@ -0,0 +1,65 @@
+#include "ChapterIndex.hpp"
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+auto createIndex = [] {
+    return ChapterIndex{std::vector<FilmDetails::ChapterDetails>{
+        {.name = "Intro", .startTime = 0s, .endTime = 10s},
+        {.name = "Explanation", .startTime = 10s, .endTime = 70s},
+        {.name = "Summary", .startTime = 70s, .endTime = 85s},
+        {.name = "Goodbye", .startTime = 85s, .endTime = 100s}}};
+};
+
+TEST(ChapterIndex, empty)
+{
+    const auto index = ChapterIndex{};
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.chapterAt(0s), std::nullopt);
+    ASSERT_EQ(index.filledCount(10s), 0);
+}
+
+TEST(ChapterIndex, chapterAt)
+{
+    const auto index = createIndex();
+    ASSERT_EQ(index.size(), 4);
+    ASSERT_EQ(index.chapterAt(0s), 0);
+    ASSERT_EQ(index.chapterAt(9999ms), 0);
+    ASSERT_EQ(index.chapterAt(10s), 1);
+    ASSERT_EQ(index.chapterAt(84s), 2);
+    ASSERT_EQ(index.chapterAt(99s), 3);
+    ASSERT_EQ(index.chapterAt(100s), std::nullopt);
+    ASSERT_EQ(index.chapterAt(-1ms), std::nullopt);
+}
+
+TEST(ChapterIndex, chapterAtWithGaps)
+{
+    const auto index = ChapterIndex{std::vector<FilmDetails::ChapterDetails>{
+        {.name = "First", .startTime = 10s, .endTime = 20s}, {.name = "Second", .startTime = 30s, .endTime = 40s}}};
+    ASSERT_EQ(index.chapterAt(5s), std::nullopt);
+    ASSERT_EQ(index.chapterAt(15s), 0);
+    ASSERT_EQ(index.chapterAt(25s), std::nullopt);
+    ASSERT_EQ(index.chapterAt(35s), 1);
+}
+
+TEST(ChapterIndex, filledCount)
+{
+    const auto index = createIndex();
+    ASSERT_EQ(index.filledCount(0s), 0);
+    ASSERT_EQ(index.filledCount(9s), 0);
+    ASSERT_EQ(index.filledCount(10s), 1);
+    ASSERT_EQ(index.filledCount(80s), 2);
+    ASSERT_EQ(index.filledCount(100s), 4);
+}
+
+TEST(ChapterIndex, manyChapters)
+{
+    constexpr auto ChaptersCount = 100'000;
+    auto chapters = std::vector<FilmDetails::ChapterDetails>{};
+    for (auto i = 0; i < ChaptersCount; ++i) {
+        chapters.push_back({.startTime = std::chrono::seconds{i}, .endTime = std::chrono::seconds{i + 1}});
+    }
+    const auto index = ChapterIndex{chapters};
+    ASSERT_EQ(index.chapterAt(std::chrono::milliseconds{12'345'678}), 12'345);
+    ASSERT_EQ(index.filledCount(std::chrono::milliseconds{12'345'678}), 12'345);
+}
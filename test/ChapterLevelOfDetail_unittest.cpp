@@ -0,0 +1,75 @@
+#include "ChapterLevelOfDetail.hpp"
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+auto createChapters = [](int count, std::chrono::milliseconds chapterDuration) {
+    auto chapters = std::vector<FilmDetails::ChapterDetails>{};
+    for (auto i = 0; i < count; ++i) {
+        chapters.push_back({.startTime = i * chapterDuration, .endTime = (i + 1) * chapterDuration});
+    }
+    return chapters;
+};
+
+TEST(ChapterLevelOfDetail, wideChaptersAreKept)
+{
+    const auto lod = ChapterLevelOfDetail{createChapters(4, 25s)};
+    const auto segments = lod.segments(400, 0s, 100s, 4);
+    ASSERT_EQ(segments.size(), 4);
+    for (auto i = std::size_t{0}; i < segments.size(); ++i) {
+        ASSERT_FALSE(segments[i].aggregated());
+        ASSERT_EQ(segments[i].firstChapter, i);
+        ASSERT_EQ(segments[i].startTime, i * 25s);
+    }
+}
+
+TEST(ChapterLevelOfDetail, narrowChaptersAreMerged)
+{
+    const auto lod = ChapterLevelOfDetail{createChapters(10'000, 1s)};
+    const auto segments = lod.segments(500, 0s, 10'000s, 5);
+    ASSERT_EQ(segments.size(), 100);
+    ASSERT_TRUE(segments.front().aggregated());
+    ASSERT_EQ(segments.front().firstChapter, 0);
+    ASSERT_EQ(segments.front().lastChapter, 99);
+    ASSERT_EQ(segments.front().endTime, 100s);
+    ASSERT_EQ(segments.back().lastChapter, 9'999);
+    ASSERT_EQ(segments.back().endTime, 10'000s);
+}
+
+TEST(ChapterLevelOfDetail, mixedWidths)
+{
+    auto chapters = createChapters(100, 100ms);
+    chapters.push_back({.name = "Long", .startTime = 10s, .endTime = 100s});
+    const auto lod = ChapterLevelOfDetail{chapters};
+    const auto segments = lod.segments(100, 0s, 100s, 5);
+    ASSERT_EQ(segments.size(), 3);
+    ASSERT_EQ(segments[0].lastChapter, 49);
+    ASSERT_EQ(segments[1].lastChapter, 99);
+    ASSERT_FALSE(segments[2].aggregated());
+    ASSERT_EQ(segments[2].firstChapter, 100);
+}
+
+TEST(ChapterLevelOfDetail, empty)
+{
+    ASSERT_TRUE(ChapterLevelOfDetail{}.segments(100, 0s, 10s, 4).empty());
+    ASSERT_TRUE(ChapterLevelOfDetail{createChapters(3, 1s)}.segments(0, 0s, 3s, 4).empty());
+}
+
+TEST(ChapterLevelOfDetail, visibleRange)
+{
+    const auto lod = ChapterLevelOfDetail{createChapters(1'000'000, 1s)};
+    const auto segments = lod.segments(100, 500'000s, 500'100s, 1);
+    ASSERT_EQ(segments.size(), 100);
+    ASSERT_EQ(segments.front().firstChapter, 500'000);
+    ASSERT_EQ(segments.back().lastChapter, 500'099);
+}
+
+TEST(ChapterLevelOfDetail, partiallyVisibleChapters)
+{
+    const auto lod = ChapterLevelOfDetail{createChapters(10, 10s)};
+    const auto segments = lod.segments(100, 15s, 35s, 1);
+    ASSERT_EQ(segments.size(), 3);
+    ASSERT_EQ(segments.front().firstChapter, 1);
+    ASSERT_EQ(segments.front().startTime, 10s);
+    ASSERT_EQ(segments.back().lastChapter, 3);
+}
@@ -0,0 +1,31 @@
+#include "AllocationCounter.hpp"
+#include "CurrrentTimeLabel.hpp"
+#include <gtest/gtest.h>
+
+TEST(CurrentTimeLabel, showsPlaceholderUntilSeekable)
+{
+    auto controller = FilmController{{.name = "Test", .duration = std::chrono::minutes{12}}};
+    auto label = CurrentTimeLabel{controller};
+    ASSERT_EQ(label.text(), "");
+    controller.pause();
+    ASSERT_EQ(label.text(), "0:00 / 12:00");
+}
+
+TEST(CurrentTimeLabel, steadyPlaybackDoesNotAllocate)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = std::chrono::hours{3}}, timeSource};
+    auto label = CurrentTimeLabel{controller};
+    controller.play();
+    timeSource->advance(std::chrono::seconds{1});
+    controller.update();
+    ASSERT_EQ(label.text(), "0:00:01 / 3:00:00");
+
+    const auto before = allocationStats().allocations;
+    for (auto i = 0; i < 1'000'000; ++i) {
+        timeSource->advance(std::chrono::milliseconds{7});
+        controller.update();
+    }
+    ASSERT_EQ(allocationStats().allocations, before);
+    ASSERT_EQ(label.text(), "1:56:41 / 3:00:00");
+}
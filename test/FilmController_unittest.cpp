@@ -67,6 +67,29 @@ TEST(FilmController, atEnd)
     ASSERT_TRUE(controller.atEnd());
 }
 
+TEST(FilmController, seekModes)
+{
+    auto controller = createController(
+        {.name = "Test",
+         .duration = FilmDuration,
+         .keyframes = KeyframeIndex::uniform(std::chrono::seconds{2}, FilmDuration)});
+    controller.pause();
+    controller.jumpTo(std::chrono::milliseconds{4900}, SeekMode::Fast);
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{4});
+    controller.jumpTo(std::chrono::milliseconds{5100}, SeekMode::Fast);
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{6});
+    controller.jumpTo(std::chrono::milliseconds{5100}, SeekMode::Exact);
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{5100});
+}
+
+TEST(FilmController, fastSeekWithoutKeyframes)
+{
+    auto controller = createController();
+    controller.pause();
+    controller.jumpTo(std::chrono::milliseconds{5100}, SeekMode::Fast);
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{5100});
+}
+
 TEST(FilmController, jumpBackward)
 {
     auto controller = createController();
@@ -99,15 +122,401 @@ TEST(FilmController, jumpForward)
     ASSERT_EQ(controller.currentTime(), FilmDuration);
 }
 
-TEST(FilmController, update)
+TEST(FilmController, jumpTargets)
 {
     auto controller = createController();
+    ASSERT_EQ(controller.forwardJumpTarget(std::chrono::seconds{25}), std::chrono::seconds{35});
+    ASSERT_EQ(controller.backwardJumpTarget(std::chrono::seconds{25}), std::chrono::seconds{15});
+    ASSERT_EQ(controller.backwardJumpTarget(std::chrono::seconds{5}), std::chrono::seconds{0});
+    ASSERT_EQ(controller.forwardJumpTarget(FilmDuration - std::chrono::seconds{5}), FilmDuration);
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{0});
+}
+
+TEST(FilmController, update)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
     controller.play();
     ASSERT_EQ(controller.currentTime(), std::chrono::seconds{0});
-    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    timeSource->advance(std::chrono::milliseconds{100});
     controller.update();
-    ASSERT_GE(controller.currentTime(), std::chrono::milliseconds{100});
-    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{100});
+    timeSource->advance(std::chrono::milliseconds{200});
+    controller.update();
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{300});
+}
+
+TEST(FilmController, updateWithSteadyTimeSource)
+{
+    auto controller = createController();
+    controller.play();
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
     controller.update();
-    ASSERT_GE(controller.currentTime(), std::chrono::milliseconds{300});
-}
\ No newline at end of file
+    ASSERT_GE(controller.currentTime(), std::chrono::milliseconds{20});
+}
+
+TEST(FilmController, updateAccumulatesSubMilliseconds)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    controller.play();
+    for (auto i = 0; i < 1000; ++i) {
+        timeSource->advance(std::chrono::microseconds{999});
+        controller.update();
+    }
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{999});
+}
+
+TEST(FilmController, updateStopsAtEnd)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = std::chrono::hours{3}}, timeSource};
+    controller.play();
+    const auto frameInterval = std::chrono::nanoseconds{std::chrono::seconds{1}} / 144;
+    while (controller.playing()) {
+        timeSource->advance(frameInterval);
+        controller.update();
+    }
+    ASSERT_TRUE(controller.atEnd());
+    ASSERT_EQ(controller.currentTime(), std::chrono::hours{3});
+}
+
+TEST(FilmController, jumpNotifiesOnce)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    auto notifiedCounter = 0;
+    controller.onCurrentTimeChanged([&] { ++notifiedCounter; });
+    controller.play();
+    timeSource->advance(std::chrono::milliseconds{100});
+    controller.resetNotificationStats();
+    controller.jumpForward();
+    ASSERT_EQ(notifiedCounter, 1);
+    ASSERT_EQ(controller.notificationStats().raised, 2);
+    ASSERT_EQ(controller.notificationStats().delivered, 1);
+}
+
+TEST(FilmController, batchCoalescesNotifications)
+{
+    auto controller = createController();
+    auto timeNotifications = 0;
+    auto stateNotifications = 0;
+    auto notifiedTime = std::chrono::milliseconds{};
+    controller.onCurrentTimeChanged([&] {
+        ++timeNotifications;
+        notifiedTime = controller.currentTime();
+    });
+    controller.onStateChanged([&] { ++stateNotifications; });
+    controller.pause();
+    controller.resetNotificationStats();
+    {
+        const auto batch = controller.batch();
+        for (auto i = 1; i <= 50; ++i) {
+            controller.jumpTo(std::chrono::milliseconds{i * 100});
+        }
+        controller.play();
+        controller.pause();
+        ASSERT_EQ(timeNotifications, 0);
+        ASSERT_EQ(stateNotifications, 1);
+    }
+    ASSERT_EQ(timeNotifications, 1);
+    ASSERT_EQ(stateNotifications, 2);
+    ASSERT_EQ(notifiedTime, std::chrono::seconds{5});
+    ASSERT_EQ(controller.notificationStats().delivered, 2);
+    ASSERT_EQ(controller.notificationStats().raised, 52);
+}
+
+TEST(FilmController, nestedBatchDeliversAtOutermostEnd)
+{
+    auto controller = createController();
+    auto notifiedCounter = 0;
+    controller.onCurrentTimeChanged([&] { ++notifiedCounter; });
+    controller.pause();
+    {
+        const auto outer = controller.batch();
+        {
+            const auto inner = controller.batch();
+            controller.jumpForward();
+        }
+        ASSERT_EQ(notifiedCounter, 0);
+        controller.jumpForward();
+    }
+    ASSERT_EQ(notifiedCounter, 1);
+}
+
+TEST(FilmController, quantizedByStep)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    auto everyUpdateCounter = 0;
+    auto perSecondCounter = 0;
+    controller.onCurrentTimeChanged([&] { ++everyUpdateCounter; });
+    controller.onCurrentTimeChanged(std::chrono::seconds{1}, [&] { ++perSecondCounter; });
+    controller.play();
+    for (auto i = 0; i < 1000; ++i) {
+        timeSource->advance(std::chrono::milliseconds{10});
+        controller.update();
+    }
+    ASSERT_EQ(everyUpdateCounter, 1000);
+    ASSERT_EQ(perSecondCounter, 10);
+}
+
+TEST(FilmController, quantizedByBucket)
+{
+    auto controller = createController();
+    auto bucketChanges = 0;
+    static constexpr auto Width = 6;
+    const auto connection = controller.onCurrentTimeChanged(
+        [](auto time) { return std::int64_t(time * Width / FilmDuration); }, [&] { ++bucketChanges; });
+    controller.pause();
+    controller.jumpTo(std::chrono::seconds{5});
+    ASSERT_EQ(bucketChanges, 0);
+    controller.jumpTo(std::chrono::seconds{10});
+    ASSERT_EQ(bucketChanges, 1);
+    controller.jumpTo(std::chrono::seconds{15});
+    ASSERT_EQ(bucketChanges, 1);
+    controller.jumpTo(std::chrono::seconds{0});
+    ASSERT_EQ(bucketChanges, 2);
+}
+
+TEST(FilmController, filmDetailsWithoutCopy)
+{
+    auto controller = createController();
+    ASSERT_EQ(&controller.filmDetails(), &controller.filmDetails());
+    ASSERT_EQ(controller.filmDetailsSnapshot().get(), &controller.filmDetails());
+}
+
+TEST(FilmController, takesSnapshotWithoutCopy)
+{
+    auto details = FilmDetails::allocateShared(256);
+    details->name = "Test";
+    details->duration = FilmDuration;
+    const auto *snapshot = details.get();
+    const auto controller = FilmController{std::move(details)};
+    ASSERT_EQ(&controller.filmDetails(), snapshot);
+    ASSERT_EQ(controller.filmDetailsSnapshot().get(), snapshot);
+}
+
+TEST(FilmController, publishFilmDetails)
+{
+    auto controller = createController();
+    auto notifiedCounter = 0;
+    controller.onFilmDetailsChanged([&] { ++notifiedCounter; });
+    const auto oldSnapshot = controller.filmDetailsSnapshot();
+
+    auto details = std::make_shared<FilmDetails>(FilmDetails{
+        .name = "Late metadata",
+        .duration = FilmDuration,
+        .chapters = {{.name = "Only", .startTime = std::chrono::seconds{0}, .endTime = FilmDuration}}});
+    const auto *published = details.get();
+    controller.publishFilmDetails(std::move(details));
+    ASSERT_EQ(notifiedCounter, 0);
+    ASSERT_EQ(controller.filmDetails().name, "Test");
+
+    controller.update();
+    ASSERT_EQ(notifiedCounter, 1);
+    ASSERT_EQ(&controller.filmDetails(), published);
+    ASSERT_EQ(controller.filmDetails().chapters.size(), 1);
+    ASSERT_EQ(oldSnapshot->name, "Test");
+
+    controller.update();
+    ASSERT_EQ(notifiedCounter, 1);
+}
+
+TEST(FilmController, publishFilmDetailsFromAnotherThread)
+{
+    auto controller = createController();
+    auto publisher = std::thread{[&] {
+        controller.publishFilmDetails(
+            std::make_shared<FilmDetails>(FilmDetails{.name = "Shorter", .duration = std::chrono::seconds{30}}));
+    }};
+    controller.pause();
+    controller.jumpTo(std::chrono::seconds{50});
+    publisher.join();
+    controller.update();
+    ASSERT_EQ(controller.filmDetails().name, "Shorter");
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{30});
+}
+
+TEST(FilmController, bufferingLeavesLoadingWhenCurrentTimeIsBuffered)
+{
+    auto controller = createController();
+    auto stateChanges = 0;
+    auto bufferedChanges = 0;
+    controller.onStateChanged([&] { ++stateChanges; });
+    controller.onBufferedRangesChanged([&] { ++bufferedChanges; });
+    controller.setBufferingEnabled(true);
+    ASSERT_TRUE(controller.loading());
+    ASSERT_TRUE(controller.seekable());
+
+    controller.addBufferedRange(std::chrono::seconds{5}, std::chrono::seconds{10});
+    ASSERT_TRUE(controller.loading());
+    ASSERT_EQ(bufferedChanges, 1);
+    controller.addBufferedRange(std::chrono::seconds{0}, std::chrono::seconds{5});
+    ASSERT_TRUE(controller.paused());
+    ASSERT_EQ(stateChanges, 1);
+    ASSERT_EQ(controller.bufferedRanges().size(), 1);
+}
+
+TEST(FilmController, jumpToUnbufferedTimeEntersLoading)
+{
+    auto controller = createController();
+    controller.setBufferingEnabled(true);
+    controller.addBufferedRange(std::chrono::seconds{0}, std::chrono::seconds{10});
+    controller.play();
+    ASSERT_TRUE(controller.playing());
+
+    controller.jumpTo(std::chrono::seconds{30});
+    ASSERT_TRUE(controller.loading());
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{30});
+    controller.jumpTo(std::chrono::seconds{40});
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{40});
+
+    controller.addBufferedRange(std::chrono::seconds{40}, std::chrono::seconds{45});
+    ASSERT_TRUE(controller.playing());
+    controller.jumpTo(std::chrono::seconds{5});
+    ASSERT_TRUE(controller.playing());
+}
+
+TEST(FilmController, pauseWhileLoadingIsKeptForLater)
+{
+    auto controller = createController();
+    controller.setBufferingEnabled(true);
+    controller.play();
+    ASSERT_TRUE(controller.loading());
+    controller.pause();
+    controller.play();
+    controller.addBufferedRange(std::chrono::seconds{0}, std::chrono::seconds{10});
+    ASSERT_TRUE(controller.playing());
+}
+
+TEST(FilmController, playbackStopsAtBufferedEnd)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    controller.setBufferingEnabled(true);
+    controller.addBufferedRange(std::chrono::seconds{0}, std::chrono::seconds{2});
+    controller.play();
+    timeSource->advance(std::chrono::seconds{3});
+    controller.update();
+    ASSERT_EQ(controller.currentTime(), std::chrono::seconds{2});
+    ASSERT_TRUE(controller.loading());
+
+    timeSource->advance(std::chrono::seconds{1});
+    controller.addBufferedRange(std::chrono::seconds{2}, std::chrono::seconds{4});
+    ASSERT_TRUE(controller.playing());
+    timeSource->advance(std::chrono::milliseconds{500});
+    controller.update();
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{2500});
+}
+
+TEST(FilmController, watermarksStallAndResumePlayback)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    controller.setBufferingEnabled(true);
+    controller.setBufferingSettings(
+        {.lowWatermark = std::chrono::seconds{2}, .highWatermark = std::chrono::seconds{6}});
+    controller.play();
+    timeSource->advance(std::chrono::seconds{1});
+    controller.addBufferedRange(std::chrono::seconds{0}, std::chrono::seconds{4});
+    ASSERT_TRUE(controller.loading());
+    controller.addBufferedRange(std::chrono::seconds{4}, std::chrono::seconds{6});
+    ASSERT_TRUE(controller.playing());
+    ASSERT_EQ(controller.bufferingStats().startupLatency, std::chrono::seconds{1});
+
+    timeSource->advance(std::chrono::milliseconds{4500});
+    controller.update();
+    ASSERT_TRUE(controller.loading());
+    ASSERT_EQ(controller.bufferedAhead(), std::chrono::milliseconds{1500});
+    ASSERT_EQ(controller.bufferingStats().stallCount, 1);
+
+    timeSource->advance(std::chrono::seconds{1});
+    controller.addBufferedRange(std::chrono::seconds{6}, std::chrono::seconds{8});
+    ASSERT_TRUE(controller.loading());
+    controller.addBufferedRange(std::chrono::seconds{8}, std::chrono::seconds{12});
+    ASSERT_TRUE(controller.playing());
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{4500});
+    ASSERT_EQ(controller.bufferingStats().stallCount, 1);
+    ASSERT_EQ(controller.bufferingStats().stallDuration, std::chrono::seconds{1});
+}
+
+TEST(FilmController, lowWatermarkIgnoredNearTheEnd)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    controller.setBufferingEnabled(true);
+    controller.setBufferingSettings(
+        {.lowWatermark = std::chrono::seconds{2}, .highWatermark = std::chrono::seconds{6}});
+    controller.addBufferedRange(std::chrono::seconds{59}, FilmDuration);
+    controller.jumpTo(std::chrono::seconds{59});
+    controller.play();
+    ASSERT_TRUE(controller.playing());
+    timeSource->advance(std::chrono::milliseconds{500});
+    controller.update();
+    ASSERT_TRUE(controller.playing());
+    ASSERT_EQ(controller.bufferingStats().stallCount, 0);
+}
+
+TEST(FilmController, pullsSegmentsUpToReadAhead)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    auto source = SimulatedSegmentSource{{.startupLatency = std::chrono::seconds{1}, .bandwidth = 5.0}, timeSource};
+    controller.setBufferingEnabled(true);
+    controller.setBufferingSettings(
+        {.segmentDuration = std::chrono::seconds{5}, .readAhead = std::chrono::seconds{12}});
+    controller.setSegmentSource(&source);
+    ASSERT_EQ(source.requestCount(), 1);
+
+    timeSource->advance(std::chrono::seconds{2});
+    controller.update();
+    ASSERT_TRUE(controller.paused());
+    ASSERT_EQ(controller.bufferedAhead(), std::chrono::seconds{5});
+    for (auto i = 0; i < 4; ++i) {
+        timeSource->advance(std::chrono::seconds{1});
+        controller.update();
+    }
+    ASSERT_EQ(controller.bufferedAhead(), std::chrono::seconds{15});
+    ASSERT_EQ(source.requestCount(), 3);
+
+    controller.jumpTo(std::chrono::seconds{40});
+    ASSERT_TRUE(controller.loading());
+    ASSERT_EQ(source.requestCount(), 4);
+    timeSource->advance(std::chrono::seconds{1});
+    controller.update();
+    ASSERT_EQ(
+        controller.bufferedRanges().intervalAt(std::chrono::seconds{40}),
+        (IntervalSet::Interval{std::chrono::seconds{40}, std::chrono::seconds{45}}));
+    ASSERT_TRUE(controller.paused());
+}
+
+TEST(FilmController, publishingFilmDetailsDropsBufferedRanges)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto controller = FilmController{{.name = "Test", .duration = FilmDuration}, timeSource};
+    auto source = SimulatedSegmentSource{{.bandwidth = 5.0}, timeSource};
+    controller.setBufferingEnabled(true);
+    controller.setSegmentSource(&source);
+    timeSource->advance(std::chrono::seconds{1});
+    controller.update();
+    ASSERT_TRUE(controller.paused());
+    ASSERT_EQ(controller.bufferedAhead(), std::chrono::seconds{5});
+    auto bufferedChanges = 0;
+    controller.onBufferedRangesChanged([&] { ++bufferedChanges; });
+
+    controller.publishFilmDetails(
+        std::make_shared<FilmDetails>(FilmDetails{.name = "Other film", .duration = std::chrono::seconds{30}}));
+    controller.update();
+    ASSERT_EQ(bufferedChanges, 1);
+    ASSERT_TRUE(controller.bufferedRanges().empty());
+    ASSERT_TRUE(controller.loading());
+
+    timeSource->advance(std::chrono::seconds{1});
+    controller.update();
+    ASSERT_EQ(source.deliveredSegments(), 2);
+    ASSERT_EQ(
+        controller.bufferedRanges().intervalAt(std::chrono::seconds{0}),
+        (IntervalSet::Interval{std::chrono::seconds{0}, std::chrono::seconds{5}}));
+    ASSERT_TRUE(controller.paused());
+}
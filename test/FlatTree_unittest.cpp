@@ -0,0 +1,274 @@
+#include "FlatTree.hpp"
+#include "Layout.hpp"
+#include "Spacer.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+auto createElement = [](sf::Vector2f size) {
+    auto element = std::make_unique<UiElement>();
+    element->setSize(size);
+    return element;
+};
+
+struct FlatTreeTest : testing::Test
+{
+    void SetUp() override
+    {
+        root.setSize({100, 100});
+        root.setPosition({10, 10});
+        root.setPadding(5);
+        auto row = std::make_unique<Layout>(Orientation::Horizontal);
+        row->setFillWidth(true);
+        row->setFillHeight(false);
+        auto left = createElement({20, 20});
+        auto right = createElement({20, 20});
+        leftPtr = left.get();
+        rightPtr = right.get();
+        row->addEntry(std::move(left));
+        row->addEntry(std::make_unique<HSpacer>());
+        row->addEntry(std::move(right));
+        rowPtr = row.get();
+        root.addEntry(std::move(row));
+        auto bottom = createElement({90, 30});
+        bottomPtr = bottom.get();
+        root.addEntry(std::move(bottom));
+        root.updateLayout();
+        tree.rebuild(root);
+    }
+
+    Layout root{Orientation::Vertical};
+    FlatTree tree;
+    Layout *rowPtr{};
+    UiElement *leftPtr{};
+    UiElement *rightPtr{};
+    UiElement *bottomPtr{};
+};
+
+TEST_F(FlatTreeTest, depthFirstOrder)
+{
+    ASSERT_EQ(tree.size(), 6);
+    ASSERT_EQ(&tree.element(0), &root);
+    ASSERT_EQ(&tree.element(1), rowPtr);
+    ASSERT_EQ(&tree.element(2), leftPtr);
+    ASSERT_EQ(&tree.element(4), rightPtr);
+    ASSERT_EQ(&tree.element(5), bottomPtr);
+
+    ASSERT_EQ(tree.parent(0), FlatTree::NoNode);
+    ASSERT_EQ(tree.parent(1), 0);
+    ASSERT_EQ(tree.parent(4), 1);
+    ASSERT_EQ(tree.parent(5), 0);
+    ASSERT_EQ(tree.nextSibling(1), 5);
+    ASSERT_EQ(tree.nextSibling(2), 3);
+    ASSERT_EQ(tree.nextSibling(4), FlatTree::NoNode);
+    ASSERT_EQ(tree.nextSibling(5), FlatTree::NoNode);
+
+    ASSERT_FALSE(tree.flags(1) & FlatTree::Leaf);
+    ASSERT_TRUE(tree.flags(2) & FlatTree::Leaf);
+}
+
+TEST_F(FlatTreeTest, absoluteRects)
+{
+    ASSERT_EQ(tree.rect(0).getPosition(), (sf::Vector2f{10, 10}));
+    ASSERT_EQ(tree.rect(1).getPosition(), (sf::Vector2f{15, 15}));
+    ASSERT_EQ(tree.rect(4).getPosition(), (sf::Vector2f{85, 15}));
+    ASSERT_EQ(tree.rect(5).getPosition(), (sf::Vector2f{15, 35}));
+
+    root.setPosition({0, 0});
+    tree.sync();
+    ASSERT_EQ(tree.rect(4).getPosition(), (sf::Vector2f{75, 5}));
+}
+
+TEST_F(FlatTreeTest, updateLayoutSyncsOnlyAfterArrange)
+{
+    leftPtr->setSize({30, 20});
+    ASSERT_EQ(tree.rect(3).getPosition(), (sf::Vector2f{35, 15}));
+    tree.updateLayout();
+    ASSERT_TRUE(root.layoutValid());
+    ASSERT_EQ(tree.rect(2).width, 30);
+    ASSERT_EQ(tree.rect(3).getPosition(), (sf::Vector2f{45, 15}));
+
+    root.setPosition({0, 0});
+    tree.updateLayout();
+    ASSERT_EQ(tree.rect(0).getPosition(), (sf::Vector2f{10, 10}));
+}
+
+TEST_F(FlatTreeTest, hitTestFindsDeepestNode)
+{
+    ASSERT_EQ(tree.hitTest({20, 20}), 2);
+    ASSERT_EQ(tree.hitTest({90, 20}), 4);
+    ASSERT_EQ(tree.hitTest({50, 20}), 1);
+    ASSERT_EQ(tree.hitTest({50, 50}), 5);
+    ASSERT_EQ(tree.hitTest({50, 100}), 0);
+    ASSERT_EQ(tree.hitTest({5, 5}), std::nullopt);
+}
+
+TEST_F(FlatTreeTest, layoutChildrenAreOrderedAlongAxis)
+{
+    ASSERT_TRUE(tree.flags(0) & FlatTree::ChildrenAlongY);
+    ASSERT_TRUE(tree.flags(1) & FlatTree::ChildrenAlongX);
+
+    ASSERT_EQ(tree.hitTest({15, 15}), 2);
+    ASSERT_EQ(tree.hitTest({34.9f, 20}), 2);
+    ASSERT_EQ(tree.hitTest({35, 20}), 1);
+    ASSERT_EQ(tree.hitTest({104.9f, 34.9f}), 4);
+    ASSERT_EQ(tree.hitTest({50, 35}), 5);
+}
+
+namespace {
+// Places its children freely, so they may overlap.
+struct Stack : UiElement
+{
+    std::size_t childCount() const override { return children.size(); }
+    UiElement *child(std::size_t index) const override { return children[index].get(); }
+
+    std::vector<std::unique_ptr<UiElement>> children;
+};
+} // namespace
+
+TEST(FlatTree, overlappingChildrenAreTestedInOrder)
+{
+    auto stack = Stack{};
+    stack.setSize({100, 100});
+    stack.children.push_back(createElement({60, 60}));
+    stack.children.push_back(createElement({60, 60}));
+    stack.children.back()->setPosition({40, 40});
+    auto tree = FlatTree{};
+    tree.rebuild(stack);
+
+    ASSERT_FALSE(tree.flags(0) & (FlatTree::ChildrenAlongX | FlatTree::ChildrenAlongY));
+    ASSERT_EQ(tree.hitTest({10, 10}), 1);
+    ASSERT_EQ(tree.hitTest({50, 50}), 1);
+    ASSERT_EQ(tree.hitTest({90, 90}), 2);
+    ASSERT_EQ(tree.hitTest({90, 10}), 0);
+}
+
+TEST_F(FlatTreeTest, routesHoverAndPress)
+{
+    tree.handleMouseMoved({20, 20});
+    ASSERT_TRUE(leftPtr->hovered());
+
+    tree.handleMouseMoved({90, 20});
+    ASSERT_FALSE(leftPtr->hovered());
+    ASSERT_TRUE(rightPtr->hovered());
+
+    tree.handleMousePressed({90, 20});
+    ASSERT_TRUE(rightPtr->pressed());
+    tree.handleMouseMoved({50, 50});
+    ASSERT_TRUE(rightPtr->dragged());
+    ASSERT_TRUE(bottomPtr->hovered());
+    tree.handleMouseReleased({50, 50});
+    ASSERT_FALSE(rightPtr->pressed());
+}
+
+TEST_F(FlatTreeTest, hoverChangeMarksDirty)
+{
+    root.clearDirty();
+    tree.handleMouseMoved({200, 200});
+    ASSERT_FALSE(root.dirty());
+    tree.handleMouseMoved({20, 20});
+    ASSERT_TRUE(root.dirty());
+    root.clearDirty();
+    tree.handleMouseMoved({21, 20});
+    ASSERT_FALSE(root.dirty());
+}
+
+class CountingElement : public UiElement
+{
+public:
+    explicit CountingElement(sf::Vector2f size)
+    {
+        setSize(size);
+    }
+
+    void handleMouseMoved(sf::Vector2i mousePosition) override
+    {
+        ++movedCount;
+        UiElement::handleMouseMoved(mousePosition);
+    }
+
+    std::size_t movedCount{};
+};
+
+TEST(FlatTree, routesEventsToElementUnderCursor)
+{
+    auto layout = Layout{Orientation::Horizontal};
+    layout.setSize({100, 20});
+    auto elements = std::vector<CountingElement *>{};
+    for (auto i = 0; i < 10; ++i) {
+        auto element = std::make_unique<CountingElement>(sf::Vector2f{10, 20});
+        elements.push_back(element.get());
+        layout.addEntry(std::move(element));
+    }
+    layout.show();
+    auto tree = FlatTree{};
+    tree.rebuild(layout);
+
+    tree.handleMouseMoved({35, 5});
+    ASSERT_TRUE(elements[3]->hovered());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(elements[i]->movedCount, i == 3 ? 1 : 0);
+    }
+
+    tree.handleMouseMoved({72, 5});
+    ASSERT_FALSE(elements[3]->hovered());
+    ASSERT_TRUE(elements[7]->hovered());
+    ASSERT_EQ(elements[3]->movedCount, 2);
+    ASSERT_EQ(elements[7]->movedCount, 1);
+    ASSERT_EQ(elements[5]->movedCount, 0);
+
+    tree.handleMouseMoved({200, 5});
+    ASSERT_FALSE(elements[7]->hovered());
+    tree.handleMouseMoved({300, 5});
+    ASSERT_EQ(elements[7]->movedCount, 2);
+}
+
+TEST(FlatTree, pressedElementReceivesDragAndRelease)
+{
+    auto layout = Layout{Orientation::Vertical};
+    layout.setSize({20, 100});
+    auto first = std::make_unique<CountingElement>(sf::Vector2f{20, 50});
+    auto second = std::make_unique<CountingElement>(sf::Vector2f{20, 50});
+    auto *firstPtr = first.get();
+    auto *secondPtr = second.get();
+    layout.addEntry(std::move(first));
+    layout.addEntry(std::move(second));
+    layout.show();
+    auto tree = FlatTree{};
+    tree.rebuild(layout);
+
+    tree.handleMouseMoved({5, 10});
+    tree.handleMousePressed({5, 10});
+    ASSERT_TRUE(firstPtr->pressed());
+    ASSERT_FALSE(secondPtr->pressed());
+
+    tree.handleMouseMoved({5, 200});
+    ASSERT_TRUE(firstPtr->dragged());
+    tree.handleMouseMoved({5, 300});
+    ASSERT_EQ(firstPtr->movedCount, 3);
+
+    tree.handleMouseReleased({5, 70});
+    ASSERT_FALSE(firstPtr->pressed());
+    ASSERT_FALSE(firstPtr->dragged());
+    ASSERT_EQ(secondPtr->movedCount, 0);
+}
+
+TEST(FlatTree, nestedLayoutLosesHover)
+{
+    auto root = Layout{Orientation::Vertical};
+    root.setSize({100, 40});
+    auto nested = std::make_unique<Layout>(Orientation::Horizontal);
+    nested->setSize({100, 20});
+    auto element = std::make_unique<CountingElement>(sf::Vector2f{10, 20});
+    auto *elementPtr = element.get();
+    nested->addEntry(std::move(element));
+    root.addEntry(std::move(nested));
+    root.addEntry(createElement({100, 20}));
+    root.show();
+    auto tree = FlatTree{};
+    tree.rebuild(root);
+
+    tree.handleMouseMoved({5, 5});
+    ASSERT_TRUE(elementPtr->hovered());
+    tree.handleMouseMoved({5, 25});
+    ASSERT_FALSE(elementPtr->hovered());
+}
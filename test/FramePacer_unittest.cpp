@@ -0,0 +1,81 @@
+#include "FramePacer.hpp"
+#include "Layout.hpp"
+#include "Spacer.hpp"
+#include <gtest/gtest.h>
+
+struct AnimatedElement : UiElement
+{
+    bool animating() const override { return true; }
+};
+
+struct FramePacerTest : testing::Test
+{
+    void SetUp() override
+    {
+        root.setSize({100, 20});
+        auto spacer = std::make_unique<HSpacer>(10);
+        spacerPtr = spacer.get();
+        root.addEntry(std::move(spacer));
+        root.show();
+    }
+
+    Layout root{Orientation::Horizontal};
+    HSpacer *spacerPtr{};
+    FramePacer pacer;
+};
+
+TEST_F(FramePacerTest, firstFrameRenders)
+{
+    ASSERT_TRUE(pacer.beginFrame(root));
+    pacer.endFrame(root, sf::milliseconds(40));
+    ASSERT_FALSE(root.dirty());
+    ASSERT_EQ(pacer.stats().renderedFrames, 1);
+    ASSERT_EQ(pacer.stats().skippedFrames, 0);
+    ASSERT_EQ(pacer.stats().timeToFirstFrame, sf::milliseconds(40));
+}
+
+TEST_F(FramePacerTest, idleFrameIsSkipped)
+{
+    ASSERT_TRUE(pacer.beginFrame(root));
+    pacer.endFrame(root, sf::milliseconds(40));
+
+    ASSERT_FALSE(pacer.beginFrame(root));
+    ASSERT_FALSE(pacer.beginFrame(root));
+    ASSERT_EQ(pacer.stats().renderedFrames, 1);
+    ASSERT_EQ(pacer.stats().skippedFrames, 2);
+}
+
+TEST_F(FramePacerTest, dirtyChildRenders)
+{
+    pacer.beginFrame(root);
+    pacer.endFrame(root, sf::milliseconds(40));
+
+    spacerPtr->setSize({15, 0});
+    ASSERT_TRUE(pacer.beginFrame(root));
+    pacer.endFrame(root, sf::milliseconds(60));
+    ASSERT_FALSE(pacer.beginFrame(root));
+    ASSERT_EQ(pacer.stats().renderedFrames, 2);
+    ASSERT_EQ(pacer.stats().skippedFrames, 1);
+    ASSERT_EQ(pacer.stats().timeToFirstFrame, sf::milliseconds(40));
+}
+
+TEST_F(FramePacerTest, animatingElementRenders)
+{
+    root.addEntry(std::make_unique<AnimatedElement>());
+    pacer.beginFrame(root);
+    pacer.endFrame(root, sf::milliseconds(40));
+
+    ASSERT_FALSE(root.dirty());
+    ASSERT_TRUE(pacer.beginFrame(root));
+    ASSERT_EQ(pacer.stats().skippedFrames, 0);
+}
+
+TEST_F(FramePacerTest, continuousModeNeverSkips)
+{
+    pacer.setRenderMode(FramePacer::RenderMode::Continuous);
+    pacer.beginFrame(root);
+    pacer.endFrame(root, sf::milliseconds(40));
+
+    ASSERT_TRUE(pacer.beginFrame(root));
+    ASSERT_EQ(pacer.stats().skippedFrames, 0);
+}
@@ -0,0 +1,71 @@
+#include "InputQueue.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+sf::Event mouseMoved(int x, int y)
+{
+    auto event = sf::Event{};
+    event.type = sf::Event::MouseMoved;
+    event.mouseMove = {x, y};
+    return event;
+}
+
+sf::Event mousePressed(int x, int y)
+{
+    auto event = sf::Event{};
+    event.type = sf::Event::MouseButtonPressed;
+    event.mouseButton = {sf::Mouse::Left, x, y};
+    return event;
+}
+
+std::vector<sf::Event> deliver(InputQueue &queue)
+{
+    auto events = std::vector<sf::Event>{};
+    queue.deliver([&](const sf::Event &event) { events.push_back(event); });
+    return events;
+}
+} // namespace
+
+TEST(InputQueue, coalescesConsecutiveMoves)
+{
+    auto queue = InputQueue{};
+    for (auto x = 0; x < 10; ++x) {
+        queue.push(mouseMoved(x, 5));
+    }
+    const auto events = deliver(queue);
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_EQ(events[0].mouseMove.x, 9);
+    ASSERT_EQ(events[0].mouseMove.y, 5);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.stats().rawEvents, 10);
+    ASSERT_EQ(queue.stats().deliveredEvents, 1);
+}
+
+TEST(InputQueue, keepsOrderAroundOtherEvents)
+{
+    auto queue = InputQueue{};
+    queue.push(mouseMoved(1, 1));
+    queue.push(mouseMoved(2, 2));
+    queue.push(mousePressed(2, 2));
+    queue.push(mouseMoved(3, 3));
+    queue.push(mouseMoved(4, 4));
+    const auto events = deliver(queue);
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].type, sf::Event::MouseMoved);
+    ASSERT_EQ(events[0].mouseMove.x, 2);
+    ASSERT_EQ(events[1].type, sf::Event::MouseButtonPressed);
+    ASSERT_EQ(events[2].mouseMove.x, 4);
+}
+
+TEST(InputQueue, countsAcrossFrames)
+{
+    auto queue = InputQueue{};
+    queue.push(mouseMoved(1, 1));
+    deliver(queue);
+    queue.push(mouseMoved(2, 2));
+    const auto events = deliver(queue);
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_EQ(events[0].mouseMove.x, 2);
+    ASSERT_EQ(queue.stats().rawEvents, 2);
+    ASSERT_EQ(queue.stats().deliveredEvents, 2);
+}
@@ -0,0 +1,90 @@
+#include "IntervalSet.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+using Interval = IntervalSet::Interval;
+
+namespace {
+std::vector<Interval> intervals(const IntervalSet &set, std::chrono::milliseconds from, std::chrono::milliseconds to)
+{
+    auto result = std::vector<Interval>{};
+    set.forEachOverlapping(from, to, [&](const auto &interval) { result.push_back(interval); });
+    return result;
+}
+} // namespace
+
+TEST(IntervalSet, insertDisjoint)
+{
+    auto set = IntervalSet{};
+    set.insert(10s, 20s);
+    set.insert(0s, 5s);
+    set.insert(30s, 40s);
+    ASSERT_EQ(set.size(), 3);
+    ASSERT_EQ(set.total(), 25s);
+    ASSERT_EQ(intervals(set, 0s, 100s), (std::vector<Interval>{{0s, 5s}, {10s, 20s}, {30s, 40s}}));
+}
+
+TEST(IntervalSet, mergesOverlappingAndTouching)
+{
+    auto set = IntervalSet{};
+    set.insert(10s, 20s);
+    set.insert(30s, 40s);
+    set.insert(20s, 25s);
+    ASSERT_EQ(set.size(), 2);
+    set.insert(15s, 35s);
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_EQ(set.intervalAt(12s), (Interval{10s, 40s}));
+    ASSERT_EQ(set.total(), 30s);
+    set.insert(0s, 100s);
+    ASSERT_EQ(intervals(set, 0s, 100s), (std::vector<Interval>{{0s, 100s}}));
+    ASSERT_EQ(set.total(), 100s);
+}
+
+TEST(IntervalSet, insertInsideExisting)
+{
+    auto set = IntervalSet{};
+    set.insert(0s, 10s);
+    set.insert(2s, 3s);
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_EQ(set.total(), 10s);
+    set.insert(5s, 5s);
+    ASSERT_EQ(set.size(), 1);
+}
+
+TEST(IntervalSet, lookupIsHalfOpen)
+{
+    auto set = IntervalSet{};
+    set.insert(10s, 20s);
+    ASSERT_FALSE(set.contains(9999ms));
+    ASSERT_TRUE(set.contains(10s));
+    ASSERT_TRUE(set.contains(19999ms));
+    ASSERT_FALSE(set.contains(20s));
+    ASSERT_EQ(set.intervalAt(20s), std::nullopt);
+}
+
+TEST(IntervalSet, forEachOverlapping)
+{
+    auto set = IntervalSet{};
+    for (auto start = 0s; start < 100s; start += 10s) {
+        set.insert(start, start + 5s);
+    }
+    ASSERT_EQ(set.size(), 10);
+    ASSERT_EQ(intervals(set, 12s, 31s), (std::vector<Interval>{{10s, 15s}, {20s, 25s}, {30s, 35s}}));
+    ASSERT_EQ(intervals(set, 15s, 20s), std::vector<Interval>{});
+    ASSERT_EQ(intervals(set, 95s, 200s), std::vector<Interval>{});
+}
+
+TEST(IntervalSet, fragmentedFill)
+{
+    auto set = IntervalSet{};
+    for (auto i = 0; i < 1000; i += 2) {
+        set.insert(std::chrono::seconds{i}, std::chrono::seconds{i + 1});
+    }
+    ASSERT_EQ(set.size(), 500);
+    for (auto i = 1; i < 1000; i += 2) {
+        set.insert(std::chrono::seconds{i}, std::chrono::seconds{i + 1});
+    }
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_EQ(set.total(), 1000s);
+}
@@ -0,0 +1,79 @@
+#include "KeyframeIndex.hpp"
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(KeyframeIndex, empty)
+{
+    const auto index = KeyframeIndex{};
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.nearest(5s), std::nullopt);
+    ASSERT_EQ(index.atOrBefore(5s), std::nullopt);
+}
+
+TEST(KeyframeIndex, sortsAndRemovesDuplicates)
+{
+    const auto index = KeyframeIndex{{4s, 0s, 2s, 2s}};
+    ASSERT_EQ(index.size(), 3);
+    ASSERT_EQ(index.at(0), 0s);
+    ASSERT_EQ(index.at(1), 2s);
+    ASSERT_EQ(index.at(2), 4s);
+}
+
+TEST(KeyframeIndex, usesGivenResource)
+{
+    auto resource = std::pmr::monotonic_buffer_resource{};
+    const auto index = KeyframeIndex::uniform(2s, 3600s, &resource);
+    ASSERT_EQ(index.get_allocator().resource(), &resource);
+
+    auto copy = KeyframeIndex{&resource};
+    copy = KeyframeIndex::uniform(1s, 10s);
+    ASSERT_EQ(copy.get_allocator().resource(), &resource);
+    ASSERT_EQ(copy.size(), 11);
+}
+
+TEST(KeyframeIndex, nearest)
+{
+    const auto index = KeyframeIndex{{1s, 2s, 4s}};
+    ASSERT_EQ(index.nearest(0s), 1s);
+    ASSERT_EQ(index.nearest(1400ms), 1s);
+    ASSERT_EQ(index.nearest(1500ms), 1s);
+    ASSERT_EQ(index.nearest(1501ms), 2s);
+    ASSERT_EQ(index.nearest(2999ms), 2s);
+    ASSERT_EQ(index.nearest(3001ms), 4s);
+    ASSERT_EQ(index.nearest(100s), 4s);
+}
+
+TEST(KeyframeIndex, atOrBefore)
+{
+    const auto index = KeyframeIndex{{1s, 2s, 4s}};
+    ASSERT_EQ(index.atOrBefore(999ms), std::nullopt);
+    ASSERT_EQ(index.atOrBefore(1s), 1s);
+    ASSERT_EQ(index.atOrBefore(3999ms), 2s);
+    ASSERT_EQ(index.atOrBefore(100s), 4s);
+}
+
+TEST(KeyframeIndex, acrossBlocks)
+{
+    const auto index = KeyframeIndex::uniform(2s, 3600s);
+    ASSERT_EQ(index.size(), 1801);
+    ASSERT_LT(index.memoryUsage(), index.size() * 5);
+    for (auto i = std::size_t{0}; i < index.size(); ++i) {
+        ASSERT_EQ(index.at(i), std::chrono::seconds{2 * i});
+    }
+    for (auto time = 0ms; time <= 3600s; time += 333ms) {
+        const auto expected = (time + 999ms) / 2s * 2s;
+        ASSERT_EQ(index.nearest(time), std::min<std::chrono::milliseconds>(expected, 3600s)) << time.count();
+        ASSERT_EQ(index.atOrBefore(time), time / 2s * 2s) << time.count();
+    }
+}
+
+TEST(KeyframeIndex, largeGaps)
+{
+    const auto gap = std::chrono::milliseconds{std::int64_t{1} << 33};
+    const auto index = KeyframeIndex{{0ms, gap, 2 * gap}};
+    ASSERT_EQ(index.at(1), gap);
+    ASSERT_EQ(index.at(2), 2 * gap);
+    ASSERT_EQ(index.nearest(gap - 1ms), gap);
+    ASSERT_EQ(index.atOrBefore(2 * gap - 1ms), gap);
+}
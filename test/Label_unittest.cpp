@@ -0,0 +1,29 @@
+#include "Label.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+std::vector<sf::Uint32> codePoints(const Label &label)
+{
+    return {label.characters().begin(), label.characters().end()};
+}
+} // namespace
+
+TEST(Label, decodesAscii)
+{
+    auto label = Label{};
+    label.setText("Intro 1");
+    ASSERT_EQ(label.text(), "Intro 1");
+    ASSERT_EQ(codePoints(label), (std::vector<sf::Uint32>{'I', 'n', 't', 'r', 'o', ' ', '1'}));
+}
+
+TEST(Label, decodesUtf8)
+{
+    auto label = Label{};
+    label.setText("Caf\xc3\xa9 \xe2\x80\x93 \xf0\x9f\x8e\xac");
+    ASSERT_EQ(label.text(), "Caf\xc3\xa9 \xe2\x80\x93 \xf0\x9f\x8e\xac");
+    ASSERT_EQ(codePoints(label), (std::vector<sf::Uint32>{'C', 'a', 'f', 0xe9, ' ', 0x2013, ' ', 0x1f3ac}));
+
+    label.setText("\xce\xa9");
+    ASSERT_EQ(codePoints(label), std::vector<sf::Uint32>{0x3a9});
+}
@@ -0,0 +1,164 @@
+#include "Layout.hpp"
+#include "Spacer.hpp"
+#include <gtest/gtest.h>
+
+auto createElement = [](sf::Vector2f size) {
+    auto element = std::make_unique<UiElement>();
+    element->setSize(size);
+    return element;
+};
+
+auto createLayout = [] {
+    auto layout = std::make_unique<Layout>(Orientation::Horizontal);
+    layout->setSize({100, 20});
+    layout->addEntry(createElement({20, 20}));
+    layout->addEntry(std::make_unique<HSpacer>());
+    layout->show();
+    layout->clearDirty();
+    return layout;
+};
+
+TEST(Layout, newElementIsDirty)
+{
+    auto layout = Layout{Orientation::Vertical};
+    ASSERT_TRUE(layout.dirty());
+    layout.clearDirty();
+    ASSERT_FALSE(layout.dirty());
+    layout.addEntry(std::make_unique<VSpacer>());
+    ASSERT_TRUE(layout.dirty());
+}
+
+TEST(Layout, clearDirtyClearsChildren)
+{
+    auto layout = Layout{Orientation::Vertical};
+    auto spacer = std::make_unique<VSpacer>();
+    const auto *spacerPtr = spacer.get();
+    layout.addEntry(std::move(spacer));
+    ASSERT_TRUE(spacerPtr->dirty());
+    layout.clearDirty();
+    ASSERT_FALSE(layout.dirty());
+    ASSERT_FALSE(spacerPtr->dirty());
+}
+
+TEST(Layout, childChangePropagatesToRoot)
+{
+    auto root = Layout{Orientation::Vertical};
+    auto nested = createLayout();
+    auto spacer = std::make_unique<HSpacer>(10);
+    auto *spacerPtr = spacer.get();
+    nested->addEntry(std::move(spacer));
+    root.addEntry(std::move(nested));
+    root.clearDirty();
+    ASSERT_FALSE(root.dirty());
+
+    spacerPtr->setSize({15, 0});
+    ASSERT_TRUE(spacerPtr->dirty());
+    ASSERT_TRUE(root.dirty());
+}
+
+TEST(Layout, notAnimating)
+{
+    auto layout = createLayout();
+    ASSERT_FALSE(layout->animating());
+}
+
+TEST(Layout, constructorSetsCrossAxisFill)
+{
+    const auto vertical = Layout{Orientation::Vertical};
+    ASSERT_TRUE(vertical.fillWidth());
+    ASSERT_FALSE(vertical.fillHeight());
+    const auto horizontal = Layout{Orientation::Horizontal};
+    ASSERT_FALSE(horizontal.fillWidth());
+    ASSERT_TRUE(horizontal.fillHeight());
+}
+
+TEST(Layout, distributesRemainingSpaceByFlex)
+{
+    auto layout = Layout{Orientation::Horizontal};
+    layout.setSize({130, 20});
+    layout.setSpacing(5);
+    layout.setPadding(5);
+    auto fixed = createElement({20, 10});
+    auto *fixedPtr = fixed.get();
+    auto single = std::make_unique<HSpacer>();
+    auto *singlePtr = single.get();
+    auto doubled = std::make_unique<HSpacer>();
+    doubled->setFlex(2);
+    auto *doubledPtr = doubled.get();
+    layout.addEntry(std::move(fixed));
+    layout.addEntry(std::move(single));
+    layout.addEntry(std::move(doubled));
+    layout.updateLayout();
+
+    ASSERT_EQ(fixedPtr->size(), (sf::Vector2f{20, 10}));
+    ASSERT_EQ(singlePtr->size().x, 30);
+    ASSERT_EQ(doubledPtr->size().x, 60);
+    ASSERT_EQ(singlePtr->getPosition(), (sf::Vector2f{30, 5}));
+    ASSERT_EQ(doubledPtr->getPosition(), (sf::Vector2f{65, 5}));
+}
+
+TEST(Layout, measuresNestedLayouts)
+{
+    auto nested = Layout{Orientation::Horizontal};
+    nested.setSpacing(2);
+    nested.setPadding(1);
+    nested.setFillHeight(false);
+    nested.addEntry(createElement({10, 4}));
+    nested.addEntry(createElement({20, 8}));
+    nested.addEntry(std::make_unique<HSpacer>());
+    ASSERT_EQ(nested.measure(), (sf::Vector2f{36, 10}));
+}
+
+TEST(Layout, resizeReflows)
+{
+    auto root = Layout{Orientation::Vertical};
+    root.setSize({100, 100});
+    auto spacer = std::make_unique<VSpacer>();
+    auto *spacerPtr = spacer.get();
+    auto row = std::make_unique<Layout>(Orientation::Horizontal);
+    row->setFillWidth(true);
+    row->setFillHeight(false);
+    auto rowSpacer = std::make_unique<HSpacer>();
+    auto *rowSpacerPtr = rowSpacer.get();
+    row->addEntry(createElement({20, 20}));
+    row->addEntry(std::move(rowSpacer));
+    auto *rowPtr = row.get();
+    root.addEntry(std::move(spacer));
+    root.addEntry(std::move(row));
+    root.updateLayout();
+    ASSERT_EQ(spacerPtr->size().y, 80);
+    ASSERT_EQ(rowPtr->getPosition().y, 80);
+    ASSERT_EQ(rowSpacerPtr->size().x, 80);
+
+    root.setSize({200, 50});
+    ASSERT_FALSE(root.layoutValid());
+    root.updateLayout();
+    ASSERT_EQ(spacerPtr->size().y, 30);
+    ASSERT_EQ(rowPtr->getPosition().y, 30);
+    ASSERT_EQ(rowSpacerPtr->size().x, 180);
+}
+
+TEST(Layout, invalidationPropagatesToRoot)
+{
+    auto root = Layout{Orientation::Vertical};
+    root.setSize({100, 100});
+    auto row = std::make_unique<Layout>(Orientation::Horizontal);
+    row->setFillHeight(false);
+    auto element = createElement({20, 20});
+    auto *elementPtr = element.get();
+    auto sibling = std::make_unique<Layout>(Orientation::Horizontal);
+    auto *siblingPtr = sibling.get();
+    row->addEntry(std::move(element));
+    root.addEntry(std::move(row));
+    root.addEntry(std::move(sibling));
+    root.updateLayout();
+    ASSERT_TRUE(root.layoutValid());
+
+    elementPtr->setSize({30, 40});
+    ASSERT_FALSE(root.layoutValid());
+    ASSERT_TRUE(siblingPtr->layoutValid());
+    root.updateLayout();
+    ASSERT_TRUE(root.layoutValid());
+    ASSERT_EQ(siblingPtr->getPosition().y, 40);
+    ASSERT_EQ(siblingPtr->size().y, 60);
+}
@@ -0,0 +1,40 @@
+#include "Scheduler.hpp"
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(Scheduler, noWakeUp)
+{
+    const auto scheduler = Scheduler{};
+    ASSERT_EQ(scheduler.nextWakeUp(), std::nullopt);
+}
+
+TEST(Scheduler, earliestWakeUpWins)
+{
+    const auto now = Scheduler::Clock::now();
+    auto scheduler = Scheduler{};
+    scheduler.wakeUpAt(now + 3s);
+    ASSERT_EQ(scheduler.nextWakeUp(), now + 3s);
+    scheduler.wakeUpAt(now + 1s);
+    ASSERT_EQ(scheduler.nextWakeUp(), now + 1s);
+    scheduler.wakeUpAt(now + 2s);
+    ASSERT_EQ(scheduler.nextWakeUp(), now + 1s);
+}
+
+TEST(Scheduler, wakeUpIn)
+{
+    auto scheduler = Scheduler{};
+    const auto before = Scheduler::Clock::now();
+    scheduler.wakeUpIn(100ms);
+    ASSERT_TRUE(scheduler.nextWakeUp());
+    ASSERT_GE(*scheduler.nextWakeUp(), before + 100ms);
+    ASSERT_LE(*scheduler.nextWakeUp(), Scheduler::Clock::now() + 100ms);
+}
+
+TEST(Scheduler, reset)
+{
+    auto scheduler = Scheduler{};
+    scheduler.wakeUpIn(1s);
+    scheduler.reset();
+    ASSERT_EQ(scheduler.nextWakeUp(), std::nullopt);
+}
@@ -0,0 +1,159 @@
+#include "SeekBar.hpp"
+#include <gtest/gtest.h>
+
+TEST(SeekBar, zeroDurationFilm)
+{
+    auto controller = FilmController{{.name = "Empty"}};
+    auto seekBar = SeekBar{controller};
+    seekBar.show();
+    seekBar.arrange({}, {200, 16});
+    ASSERT_EQ(seekBar.viewStart(), std::chrono::milliseconds{0});
+    ASSERT_EQ(seekBar.viewEnd(), std::chrono::milliseconds{0});
+
+    seekBar.zoom(2, std::chrono::milliseconds{0});
+    seekBar.handleMouseMoved({100, 8});
+    controller.jumpTo(std::chrono::milliseconds{0});
+    ASSERT_EQ(controller.currentTime(), std::chrono::milliseconds{0});
+    ASSERT_EQ(seekBar.viewEnd(), std::chrono::milliseconds{0});
+}
+
+namespace {
+using namespace std::chrono_literals;
+
+constexpr auto FilmDuration = std::chrono::milliseconds{60s};
+
+FilmDetails createFilm()
+{
+    return {
+        .name = "Test",
+        .duration = FilmDuration,
+        .chapters
+        = {{.name = "Intro", .startTime = 0s, .endTime = 20s},
+           {.name = "Middle", .startTime = 20s, .endTime = 40s},
+           {.name = "End", .startTime = 40s, .endTime = 60s}}};
+}
+
+struct SeekBarTest : testing::Test
+{
+    void SetUp() override
+    {
+        seekBar.show();
+        seekBar.arrange({}, {600, 16});
+    }
+
+    std::shared_ptr<VirtualTimeSource> timeSource = std::make_shared<VirtualTimeSource>();
+    FilmController controller{createFilm(), timeSource};
+    SeekBar seekBar{controller};
+};
+} // namespace
+
+TEST_F(SeekBarTest, viewCoversFilmInitially)
+{
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+}
+
+TEST_F(SeekBarTest, setViewClampsToFilm)
+{
+    seekBar.setView(-5s, 5s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), 10s);
+
+    seekBar.setView(55s, 70s);
+    ASSERT_EQ(seekBar.viewStart(), 45s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+
+    seekBar.setView(-10s, 90s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+}
+
+TEST_F(SeekBarTest, panStopsAtTheEdges)
+{
+    seekBar.setView(20s, 35s);
+    seekBar.pan(-100s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), 15s);
+    seekBar.pan(100s);
+    ASSERT_EQ(seekBar.viewStart(), 45s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+}
+
+TEST_F(SeekBarTest, zoomKeepsAnchorFixed)
+{
+    seekBar.zoom(2, 12s);
+    ASSERT_EQ(seekBar.viewStart(), 6s);
+    ASSERT_EQ(seekBar.viewEnd(), 36s);
+
+    seekBar.zoom(0.5f, 12s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+
+    seekBar.zoom(2, FilmDuration);
+    ASSERT_EQ(seekBar.viewStart(), 30s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+
+    seekBar.zoom(0.1f, 45s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+}
+
+TEST_F(SeekBarTest, viewHasMinimumLength)
+{
+    seekBar.setView(10s, 10200ms);
+    ASSERT_EQ(seekBar.viewStart(), 10s);
+    ASSERT_EQ(seekBar.viewEnd(), 11s);
+
+    seekBar.setView(20s, 5s);
+    ASSERT_EQ(seekBar.viewEnd() - seekBar.viewStart(), 1s);
+
+    seekBar.setView(0s, 30s);
+    seekBar.zoom(1000, 15s);
+    ASSERT_EQ(seekBar.viewEnd() - seekBar.viewStart(), 1s);
+}
+
+TEST_F(SeekBarTest, pagesDuringPlayback)
+{
+    seekBar.setView(0s, 10s);
+    controller.play();
+    timeSource->advance(9s);
+    controller.update();
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+
+    timeSource->advance(1s);
+    controller.update();
+    ASSERT_EQ(seekBar.viewStart(), 10s);
+    ASSERT_EQ(seekBar.viewEnd(), 20s);
+
+    timeSource->advance(45s);
+    controller.update();
+    ASSERT_EQ(seekBar.viewStart(), 50s);
+    ASSERT_EQ(seekBar.viewEnd(), FilmDuration);
+}
+
+TEST_F(SeekBarTest, doesNotPageWhilePaused)
+{
+    seekBar.setView(0s, 10s);
+    controller.pause();
+    controller.jumpTo(30s);
+    ASSERT_EQ(seekBar.viewStart(), 0s);
+    ASSERT_EQ(seekBar.viewEnd(), 10s);
+}
+
+TEST_F(SeekBarTest, sharesOneTooltipAcrossChapters)
+{
+    controller.pause();
+    ASSERT_EQ(seekBar.tooltip(), nullptr);
+
+    seekBar.handleMouseMoved({100, 8});
+    const auto *tooltip = seekBar.tooltip();
+    ASSERT_NE(tooltip, nullptr);
+    ASSERT_EQ(tooltip->text(), "Intro");
+    const auto introCenter = tooltip->getPosition().x + tooltip->getGlobalBounds().width / 2;
+
+    seekBar.handleMouseMoved({500, 8});
+    ASSERT_EQ(seekBar.tooltip(), tooltip);
+    ASSERT_EQ(tooltip->text(), "End");
+    const auto endCenter = tooltip->getPosition().x + tooltip->getGlobalBounds().width / 2;
+    ASSERT_GT(endCenter, introCenter + 300);
+}
@@ -0,0 +1,107 @@
+#include "SeekScheduler.hpp"
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+struct Fixture
+{
+    explicit Fixture(std::chrono::nanoseconds latency)
+        : backend{latency, timeSource}
+    {
+        connection = scheduler.onSeekCompleted([this](auto target) { completed.push_back(target.time); });
+    }
+
+    std::shared_ptr<VirtualTimeSource> timeSource = std::make_shared<VirtualTimeSource>();
+    SimulatedSeekBackend backend;
+    SeekScheduler scheduler{backend, timeSource};
+    std::vector<std::chrono::milliseconds> completed;
+    ScopedConnection connection;
+};
+} // namespace
+
+TEST(SeekScheduler, completesImmediatelyWithoutLatency)
+{
+    auto fixture = Fixture{0ms};
+    fixture.scheduler.request(5s);
+    ASSERT_EQ(fixture.completed, std::vector{5000ms});
+    ASSERT_FALSE(fixture.scheduler.busy());
+    ASSERT_EQ(fixture.scheduler.target(), std::nullopt);
+    ASSERT_EQ(fixture.scheduler.stats().lastLatency, 0ns);
+}
+
+TEST(SeekScheduler, latestRequestWins)
+{
+    auto fixture = Fixture{50ms};
+    fixture.scheduler.request(1s);
+    for (auto time = 2s; time <= 10s; time += 1s) {
+        fixture.timeSource->advance(5ms);
+        fixture.scheduler.request(time);
+        fixture.scheduler.update();
+    }
+    ASSERT_EQ(fixture.backend.seekCount(), 1);
+    ASSERT_EQ(fixture.scheduler.target(), 10s);
+
+    fixture.timeSource->advance(5ms);
+    fixture.scheduler.update();
+    ASSERT_EQ(fixture.completed, std::vector{1000ms});
+    ASSERT_EQ(fixture.backend.seekCount(), 2);
+    ASSERT_EQ(fixture.scheduler.target(), 10s);
+
+    fixture.timeSource->advance(50ms);
+    fixture.scheduler.update();
+    ASSERT_EQ(fixture.completed, (std::vector{1000ms, 10000ms}));
+    ASSERT_FALSE(fixture.scheduler.busy());
+    ASSERT_EQ(fixture.backend.maximumInFlight(), 1);
+
+    const auto &stats = fixture.scheduler.stats();
+    ASSERT_EQ(stats.requested, 10);
+    ASSERT_EQ(stats.issued, 2);
+    ASSERT_EQ(stats.completed, 2);
+    ASSERT_EQ(stats.lastLatency, 95ms);
+    ASSERT_EQ(stats.maximumLatency, 95ms);
+}
+
+TEST(SeekScheduler, rateLimit)
+{
+    auto fixture = Fixture{0ms};
+    fixture.scheduler.setMinimumInterval(30ms);
+    fixture.scheduler.request(1s);
+    fixture.timeSource->advance(10ms);
+    fixture.scheduler.request(2s);
+    fixture.timeSource->advance(10ms);
+    fixture.scheduler.request(3s);
+    ASSERT_EQ(fixture.completed, std::vector{1000ms});
+
+    auto wakeUps = Scheduler{};
+    fixture.scheduler.scheduleWakeUp(wakeUps);
+    ASSERT_TRUE(wakeUps.nextWakeUp());
+    ASSERT_LE(*wakeUps.nextWakeUp(), Scheduler::Clock::now() + 10ms);
+
+    fixture.timeSource->advance(9ms);
+    fixture.scheduler.update();
+    ASSERT_EQ(fixture.completed.size(), 1);
+    fixture.timeSource->advance(1ms);
+    fixture.scheduler.update();
+    ASSERT_EQ(fixture.completed, (std::vector{1000ms, 3000ms}));
+    ASSERT_EQ(fixture.scheduler.stats().lastLatency, 20ms);
+}
+
+TEST(SeekScheduler, dragKeepsOneSeekInFlight)
+{
+    auto fixture = Fixture{16ms};
+    for (auto frame = 0; frame < 120; ++frame) {
+        fixture.scheduler.request(std::chrono::milliseconds{frame * 100});
+        fixture.scheduler.update();
+        fixture.timeSource->advance(7ms);
+    }
+    while (fixture.scheduler.busy()) {
+        fixture.timeSource->advance(1ms);
+        fixture.scheduler.update();
+    }
+    ASSERT_EQ(fixture.backend.maximumInFlight(), 1);
+    ASSERT_LT(fixture.backend.seekCount(), 60);
+    ASSERT_EQ(fixture.completed.back(), 11900ms);
+    // A request waits at most for the seek in flight, its own seek and one frame of polling.
+    ASSERT_LE(fixture.scheduler.stats().maximumLatency, 16ms + 16ms + 7ms);
+}
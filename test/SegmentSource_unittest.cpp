@@ -0,0 +1,62 @@
+#include "SegmentSource.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(SimulatedSegmentSource, deliversInOrderAtBandwidth)
+{
+    auto timeSource = std::make_shared<VirtualTimeSource>();
+    auto source = SimulatedSegmentSource{
+        {.startupLatency = 3s, .requestLatency = 100ms, .bandwidth = 10.0}, timeSource};
+    source.request({0s, 5s});
+    source.request({5s, 10s});
+    ASSERT_EQ(source.poll(), std::nullopt);
+
+    timeSource->advance(3599ms);
+    ASSERT_EQ(source.poll(), std::nullopt);
+    timeSource->advance(1ms);
+    ASSERT_EQ(source.poll(), (SegmentSource::Segment{0s, 5s}));
+    ASSERT_EQ(source.poll(), std::nullopt);
+
+    auto scheduler = Scheduler{};
+    const auto before = Scheduler::Clock::now();
+    source.scheduleWakeUp(scheduler);
+    ASSERT_TRUE(scheduler.nextWakeUp());
+    ASSERT_GE(*scheduler.nextWakeUp() - before, 600ms);
+
+    timeSource->advance(600ms);
+    ASSERT_EQ(source.poll(), (SegmentSource::Segment{5s, 10s}));
+    ASSERT_EQ(source.deliveredSegments(), 2);
+
+    scheduler.reset();
+    source.scheduleWakeUp(scheduler);
+    ASSERT_EQ(scheduler.nextWakeUp(), std::nullopt);
+}
+
+TEST(SimulatedSegmentSource, jitterIsBoundedAndRepeatable)
+{
+    const auto completionTimes = [](std::uint64_t seed) {
+        auto timeSource = std::make_shared<VirtualTimeSource>();
+        auto source = SimulatedSegmentSource{{.jitter = 200ms, .bandwidth = 1000.0, .seed = seed}, timeSource};
+        auto times = std::vector<std::chrono::milliseconds>{};
+        for (auto i = 0; i < 20; ++i) {
+            source.request({i * 1s, (i + 1) * 1s});
+            auto elapsed = 0ms;
+            while (!source.poll()) {
+                timeSource->advance(1ms);
+                ++elapsed;
+            }
+            times.push_back(elapsed);
+        }
+        return times;
+    };
+
+    const auto times = completionTimes(7);
+    ASSERT_EQ(times, completionTimes(7));
+    ASSERT_NE(times, completionTimes(8));
+    for (const auto time : times) {
+        ASSERT_GE(time, 1ms);
+        ASSERT_LE(time, 201ms);
+    }
+}
@@ -0,0 +1,111 @@
+#include "AllocationCounter.hpp"
+#include "Signal.hpp"
+#include <gtest/gtest.h>
+
+TEST(Signal, emit)
+{
+    auto signal = Signal<void(int)>{};
+    auto sum = 0;
+    signal.connect([&](int value) { sum += value; });
+    signal.connect([&](int value) { sum += 2 * value; });
+    ASSERT_EQ(signal.size(), 2);
+    signal.emit(3);
+    ASSERT_EQ(sum, 9);
+}
+
+TEST(Signal, disconnect)
+{
+    auto signal = Signal<void()>{};
+    auto counter = 0;
+    auto connection = signal.connect([&] { ++counter; });
+    ASSERT_TRUE(connection.connected());
+    signal.emit();
+    connection.disconnect();
+    ASSERT_FALSE(connection.connected());
+    signal.emit();
+    ASSERT_EQ(counter, 1);
+    ASSERT_EQ(signal.size(), 0);
+}
+
+TEST(Signal, scopedConnection)
+{
+    auto signal = Signal<void()>{};
+    auto counter = 0;
+    {
+        auto connection = ScopedConnection{signal.connect([&] { ++counter; })};
+        signal.emit();
+    }
+    signal.emit();
+    ASSERT_EQ(counter, 1);
+}
+
+TEST(Signal, connectionOutlivesSignal)
+{
+    auto connection = ScopedConnection{};
+    {
+        auto signal = Signal<void()>{};
+        connection = signal.connect([] {});
+        ASSERT_TRUE(connection.connected());
+    }
+    ASSERT_FALSE(connection.connected());
+}
+
+TEST(Signal, connectWhileDispatching)
+{
+    auto signal = Signal<void()>{};
+    auto outerCounter = 0;
+    auto innerCounter = 0;
+    signal.connect([&] {
+        if (++outerCounter == 1) {
+            signal.connect([&] { ++innerCounter; });
+        }
+    });
+    signal.emit();
+    ASSERT_EQ(innerCounter, 0);
+    signal.emit();
+    ASSERT_EQ(outerCounter, 2);
+    ASSERT_EQ(innerCounter, 1);
+}
+
+TEST(Signal, disconnectWhileDispatching)
+{
+    auto signal = Signal<void()>{};
+    auto counter = 0;
+    auto second = Connection{};
+    signal.connect([&] { second.disconnect(); });
+    second = signal.connect([&] { ++counter; });
+    signal.emit();
+    signal.emit();
+    ASSERT_EQ(counter, 0);
+    ASSERT_EQ(signal.size(), 1);
+}
+
+TEST(Signal, nestedEmit)
+{
+    auto signal = Signal<void(int)>{};
+    auto calls = 0;
+    signal.connect([&](int depth) {
+        ++calls;
+        if (depth > 0) {
+            signal.emit(depth - 1);
+        }
+    });
+    signal.emit(3);
+    ASSERT_EQ(calls, 4);
+}
+
+TEST(Signal, emitDoesNotAllocate)
+{
+    auto signal = Signal<void(int)>{};
+    auto sum = 0;
+    auto connections = std::vector<ScopedConnection>{};
+    for (auto i = 0; i < 500; ++i) {
+        connections.emplace_back(signal.connect([&sum, i](int value) { sum += value + i; }));
+    }
+    const auto allocationsBefore = allocationStats().allocations;
+    for (auto i = 0; i < 1000; ++i) {
+        signal.emit(1);
+    }
+    ASSERT_EQ(allocationStats().allocations, allocationsBefore);
+    ASSERT_GT(sum, 0);
+}
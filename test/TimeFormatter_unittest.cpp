@@ -0,0 +1,52 @@
+#include "AllocationCounter.hpp"
+#include "TimeFormatter.hpp"
+#include <gtest/gtest.h>
+
+TEST(TimeFormatter, minutesAndSeconds)
+{
+    auto formatter = TimeFormatter{};
+    ASSERT_TRUE(formatter.update(std::chrono::seconds{65}, std::chrono::minutes{12}));
+    ASSERT_EQ(formatter.text(), "1:05 / 12:00");
+}
+
+TEST(TimeFormatter, hours)
+{
+    auto formatter = TimeFormatter{};
+    ASSERT_TRUE(formatter.update(std::chrono::seconds{3605}, std::chrono::hours{2} + std::chrono::seconds{30}));
+    ASSERT_EQ(formatter.text(), "1:00:05 / 2:00:30");
+    ASSERT_TRUE(formatter.update(std::chrono::seconds{59}, std::chrono::hours{1}));
+    ASSERT_EQ(formatter.text(), "0:00:59 / 1:00:00");
+}
+
+TEST(TimeFormatter, unchangedSecond)
+{
+    auto formatter = TimeFormatter{};
+    ASSERT_TRUE(formatter.update(std::chrono::milliseconds{1000}, std::chrono::minutes{1}));
+    ASSERT_FALSE(formatter.update(std::chrono::milliseconds{1999}, std::chrono::minutes{1}));
+    ASSERT_TRUE(formatter.update(std::chrono::milliseconds{2000}, std::chrono::minutes{1}));
+    ASSERT_EQ(formatter.text(), "0:02 / 1:00");
+}
+
+TEST(TimeFormatter, clear)
+{
+    auto formatter = TimeFormatter{};
+    ASSERT_FALSE(formatter.clear());
+    formatter.update(std::chrono::seconds{1}, std::chrono::minutes{1});
+    ASSERT_TRUE(formatter.clear());
+    ASSERT_EQ(formatter.text(), "");
+    ASSERT_FALSE(formatter.clear());
+    ASSERT_TRUE(formatter.update(std::chrono::seconds{1}, std::chrono::minutes{1}));
+}
+
+TEST(TimeFormatter, steadyPlaybackDoesNotAllocate)
+{
+    auto formatter = TimeFormatter{};
+    const auto duration = std::chrono::hours{3};
+    const auto before = allocationStats().allocations;
+    auto changes = 0;
+    for (auto time = std::chrono::milliseconds{}; time < duration; time += std::chrono::milliseconds{7}) {
+        changes += formatter.update(time, duration);
+    }
+    ASSERT_EQ(allocationStats().allocations, before);
+    ASSERT_EQ(changes, std::chrono::seconds{duration}.count());
+}
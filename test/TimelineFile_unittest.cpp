@@ -0,0 +1,160 @@
+#include "TimelineFile.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+FilmDetails createFilm()
+{
+    return FilmDetails{
+        .name = "film",
+        .duration = 100s,
+        .chapters
+        = {{.name = "Intro", .startTime = 0s, .endTime = 10s},
+           {.name = "", .startTime = 10s, .endTime = 70s},
+           {.name = "Summary", .startTime = 75s, .endTime = 100s}}};
+}
+
+// Keeps serialized bytes 8-byte aligned, as they would be in a mapped file.
+struct AlignedBytes
+{
+    explicit AlignedBytes(const std::string &bytes)
+        : storage((bytes.size() + 7) / 8)
+    {
+        std::memcpy(storage.data(), bytes.data(), bytes.size());
+        size = bytes.size();
+    }
+
+    std::string_view view() const { return {reinterpret_cast<const char *>(storage.data()), size}; }
+
+    std::vector<std::int64_t> storage;
+    std::size_t size{};
+};
+
+TimelineFile::Error::Code viewError(std::string bytes)
+{
+    const auto aligned = AlignedBytes{bytes};
+    const auto timeline = TimelineFile::view(aligned.view());
+    EXPECT_FALSE(timeline);
+    return timeline ? TimelineFile::Error::Code{} : timeline.error().code;
+}
+} // namespace
+
+TEST(TimelineFile, roundTrip)
+{
+    const auto bytes = TimelineFile::serialize(createFilm());
+    ASSERT_TRUE(bytes);
+    const auto aligned = AlignedBytes{*bytes};
+    const auto timeline = TimelineFile::view(aligned.view());
+    ASSERT_TRUE(timeline) << timeline.error().describe();
+    ASSERT_EQ(timeline->name(), "film");
+    ASSERT_EQ(timeline->duration(), 100s);
+    ASSERT_EQ(timeline->size(), 3);
+    ASSERT_EQ(timeline->chapterName(0), "Intro");
+    ASSERT_EQ(timeline->chapterName(1), "");
+    ASSERT_EQ(timeline->chapterName(2), "Summary");
+    ASSERT_EQ(timeline->startTime(2), 75s);
+    ASSERT_EQ(timeline->endTime(1), 70s);
+
+    const auto details = timeline->filmDetails();
+    ASSERT_EQ(details.name, "film");
+    ASSERT_EQ(details.chapters.size(), 3);
+    ASSERT_EQ(details.chapters[2].name, "Summary");
+    ASSERT_EQ(details.chapters[2].startTime, 75s);
+}
+
+TEST(TimelineFile, sharedFilmDetailsUsesOneArena)
+{
+    const auto bytes = TimelineFile::serialize(createFilm());
+    ASSERT_TRUE(bytes);
+    const auto aligned = AlignedBytes{*bytes};
+    const auto timeline = TimelineFile::view(aligned.view());
+    ASSERT_TRUE(timeline) << timeline.error().describe();
+
+    const auto details = timeline->sharedFilmDetails();
+    ASSERT_EQ(details->name, "film");
+    ASSERT_EQ(details->duration, 100s);
+    ASSERT_EQ(details->chapters.size(), 3);
+    ASSERT_EQ(details->chapters[2].name, "Summary");
+    ASSERT_EQ(details->chapters[2].startTime, 75s);
+
+    const auto *resource = details->chapters.get_allocator().resource();
+    ASSERT_NE(resource, std::pmr::get_default_resource());
+    ASSERT_EQ(details->name.get_allocator().resource(), resource);
+    ASSERT_EQ(details->chapters[0].name.get_allocator().resource(), resource);
+    ASSERT_EQ(details->keyframes.get_allocator().resource(), resource);
+}
+
+TEST(TimelineFile, emptyFilm)
+{
+    const auto bytes = TimelineFile::serialize(FilmDetails{});
+    ASSERT_TRUE(bytes);
+    ASSERT_EQ(bytes->size(), sizeof(TimelineFile::Header) + sizeof(std::uint32_t));
+    const auto aligned = AlignedBytes{*bytes};
+    const auto timeline = TimelineFile::view(aligned.view());
+    ASSERT_TRUE(timeline);
+    ASSERT_EQ(timeline->size(), 0);
+    ASSERT_EQ(timeline->name(), "");
+}
+
+TEST(TimelineFile, rejectsInvalidFiles)
+{
+    const auto bytes = *TimelineFile::serialize(createFilm());
+    const auto startTimes = sizeof(TimelineFile::Header);
+
+    ASSERT_EQ(viewError(bytes.substr(0, 20)), TimelineFile::Error::Code::Truncated);
+    ASSERT_EQ(viewError(bytes.substr(0, bytes.size() - 1)), TimelineFile::Error::Code::Truncated);
+    ASSERT_EQ(viewError(bytes + "x"), TimelineFile::Error::Code::Corrupt);
+
+    auto badMagic = bytes;
+    badMagic[0] = 'X';
+    ASSERT_EQ(viewError(badMagic), TimelineFile::Error::Code::BadMagic);
+
+    auto newerVersion = bytes;
+    newerVersion[offsetof(TimelineFile::Header, version)] = 2;
+    ASSERT_EQ(viewError(newerVersion), TimelineFile::Error::Code::UnsupportedVersion);
+
+    auto hugeCount = bytes;
+    hugeCount[offsetof(TimelineFile::Header, chapterCount) + 7] = 0x10;
+    ASSERT_EQ(viewError(hugeCount), TimelineFile::Error::Code::Truncated);
+
+    auto overlapping = bytes;
+    const auto overlappingStart = std::int64_t{5000};
+    std::memcpy(overlapping.data() + startTimes + sizeof(std::int64_t), &overlappingStart, sizeof(overlappingStart));
+    ASSERT_EQ(viewError(overlapping), TimelineFile::Error::Code::Corrupt);
+
+    auto badOffset = bytes;
+    const auto offset = std::uint32_t{100};
+    std::memcpy(
+        badOffset.data() + startTimes + 6 * sizeof(std::int64_t) + sizeof(std::uint32_t), &offset, sizeof(offset));
+    ASSERT_EQ(viewError(badOffset), TimelineFile::Error::Code::Corrupt);
+}
+
+TEST(TimelineFile, rejectsOtherByteOrder)
+{
+    auto bytes = *TimelineFile::serialize(createFilm());
+    const auto byteOrder = offsetof(TimelineFile::Header, byteOrder);
+    std::swap(bytes[byteOrder], bytes[byteOrder + 1]);
+    ASSERT_EQ(viewError(bytes), TimelineFile::Error::Code::ByteOrderMismatch);
+
+    // The byte order is checked first, since a swapped version number would be misreported.
+    bytes[offsetof(TimelineFile::Header, version)] = 0;
+    bytes[offsetof(TimelineFile::Header, version) + 1] = 1;
+    ASSERT_EQ(viewError(bytes), TimelineFile::Error::Code::ByteOrderMismatch);
+}
+
+TEST(TimelineFile, writeAndLoad)
+{
+    const auto path = std::filesystem::temp_directory_path() / "seekbar_unittest.timeline";
+    ASSERT_TRUE(TimelineFile::write(path, createFilm()));
+    const auto timeline = TimelineFile::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(timeline) << timeline.error().describe();
+    ASSERT_EQ(timeline->size(), 3);
+    ASSERT_EQ(timeline->chapterName(2), "Summary");
+
+    const auto missing = TimelineFile::load("/nonexistent/film.timeline");
+    ASSERT_FALSE(missing);
+    ASSERT_EQ(missing.error().code, TimelineFile::Error::Code::OpenFailed);
+}